@@ -0,0 +1,164 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      fsm_cfg.h
+* @brief    Finite State Machine (FSM) Benchmark Configurations
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@author    Matej Otic
+*@email     otic.matej@dancing-bits.com
+*@date      28.08.2026
+*@version   V2.1.0
+*
+*@note      Host-side stub configuration used only by benchmark suite in
+*           "bench/" - not a template for target builds! System tick is a
+*           plain variable advanced by the benchmark itself so runs are
+*           deterministic and not capped by wall clock.
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FSM_CFG
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _FSM_CFG_H_
+#define _FSM_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <assert.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *  Benchmark provided fake system tick
+ *
+ *  Unit: ms
+ */
+extern uint32_t g_bench_tick;
+
+/**
+ *  Benchmark provided debug print sink - formats into static buffer so
+ *  debug overhead measurement includes formatting but no terminal I/O
+ */
+extern void bench_dbg_print(const char * fmt, ...);
+
+/**
+ *  Get system timetick in 32-bit unsigned integer form
+ *
+ *  Unit: ms
+ */
+#define FSM_GET_SYSTICK()               ( g_bench_tick )
+
+/**
+ *    Maximum number of FSM instances
+ */
+#define FSM_CFG_MAX_INSTANCES           ( 0 )
+
+/**
+ *    Maximum number of registered FSM instances
+ */
+#define FSM_CFG_MAX_REGISTERED          ( 16 )
+
+/**
+ *    Event/state request queue size
+ */
+#define FSM_CFG_EVENT_QUEUE_SIZE        ( 8 )
+
+/**
+ *    Enable/Disable binary transition trace
+ */
+#define FSM_CFG_TRACE_EN                ( 0 )
+
+/**
+ *    Transition trace buffer size
+ */
+#define FSM_CFG_TRACE_BUF_SIZE          ( 32 )
+
+/**
+ *    Transition history ring size
+ */
+#define FSM_CFG_HISTORY_SIZE            ( 8 )
+
+/**
+ *    Size of inline user context block in bytes
+ */
+#define FSM_CFG_DATA_SIZE               ( 0 )
+
+/**
+ *    Enable/Disable hierarchical state machine support
+ */
+#define FSM_CFG_HSM_EN                  ( 0 )
+
+/**
+ *    Maximum state nesting depth (including state itself)
+ */
+#define FSM_CFG_HSM_MAX_DEPTH           ( 4 )
+
+/**
+ *    Enable/Disable per-state execution time statistics
+ */
+#define FSM_CFG_STATS_EN                ( 0 )
+
+/**
+ *    Enable/Disable resolved (branch-free) state dispatch
+ */
+#define FSM_CFG_RESOLVED_DISPATCH_EN    ( 0 )
+
+/**
+ *    Maximum number of FSM states
+ */
+#define FSM_CFG_MAX_STATES              ( 8 )
+
+/**
+ *    Enable/Disable debug mode
+ */
+#define FSM_CFG_DEBUG_EN                ( 1 )
+
+/**
+ *    Enable/Disable assertions
+ */
+#define FSM_CFG_ASSERT_EN               ( 1 )
+
+#ifndef DEBUG
+   #undef FSM_CFG_DEBUG_EN
+   #define FSM_CFG_DEBUG_EN             ( 0 )
+#endif
+
+#ifndef DEBUG
+   #undef FSM_CFG_ASSERT_EN
+   #define FSM_CFG_ASSERT_EN            ( 0 )
+#endif
+
+/**
+ *    Debug communication port macros
+ */
+#if ( 1 == FSM_CFG_DEBUG_EN )
+   #define FSM_DBG_PRINT( ... )         ( bench_dbg_print( __VA_ARGS__ ))
+#else
+   #define FSM_DBG_PRINT( ... )         { ; }
+#endif
+
+/**
+ *     Assertion macros
+ */
+#if ( 1 == FSM_CFG_ASSERT_EN )
+   #define FSM_ASSERT(x)                assert(x)
+#else
+   #define FSM_ASSERT(x)                { ; }
+#endif
+
+#endif // _FSM_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,368 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      main.c
+* @brief    Finite State Machine (FSM) Host Benchmark Suite
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@author    Matej Otic
+*@email     otic.matej@dancing-bits.com
+*@date      28.08.2026
+*@version   V2.1.0
+*
+*@note      Measures cost of module hot paths on host machine:
+*
+*               1. Steady-state "fsm_hndl" call (no transition pending)
+*               2. State transition (exit + entry + bookkeeping)
+*               3. Scaling from 1 to 1000 instances (cache effects)
+*               4. Debug build overhead (run "build/fsm_bench_dbg")
+*
+*           Release build enforces regression thresholds and exits non-zero
+*           when exceeded, so slowdowns in "fsm_manager" and friends are
+*           caught in CI. Thresholds are deliberately loose - they shall trip
+*           on algorithmic regressions (new branches, extra clock samples),
+*           not on host machine jitter. Absolute numbers are only comparable
+*           within single machine.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <time.h>
+
+#include "build/fsm/src/fsm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Benchmark iteration counts
+ */
+#define BENCH_HNDL_ITERATIONS       ( 5000000UL )
+#define BENCH_TRANS_ITERATIONS      ( 1000000UL )
+#define BENCH_SCALE_TOTAL_CALLS     ( 2000000UL )
+
+/**
+ *     Regression thresholds in ns - release build only
+ *
+ * @note    Loose on purpose - meant to catch algorithmic regressions of hot
+ *          paths, not host scheduling jitter.
+ */
+#define BENCH_THRESH_HNDL_NS        ( 500.0 )
+#define BENCH_THRESH_TRANS_NS       ( 2500.0 )
+#define BENCH_THRESH_SCALE_NS       ( 1500.0 )
+
+/**
+ *     Benchmark FSM states
+ */
+typedef enum
+{
+    eBENCH_FSM_IDLE = 0,
+    eBENCH_FSM_RUN,
+    eBENCH_FSM_AUX,
+
+    eBENCH_FSM_NUM_OF
+} bench_fsm_state_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Fake system tick - advanced by benchmark, read via FSM_GET_SYSTICK
+ */
+uint32_t g_bench_tick = 0U;
+
+/**
+ *     Handler work sink - volatile so handler bodies are not optimized away
+ */
+static volatile uint32_t gu32_bench_sink = 0U;
+
+/**
+ *     Debug print sink buffer
+ */
+static char gs_bench_dbg_buf[256];
+
+/**
+ *     Overall benchmark result - set to non-zero on threshold violation
+ */
+static int gi_bench_result = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Debug print sink - formatting without terminal I/O
+*
+*       Referenced by "FSM_DBG_PRINT" in benchmark configuration, so debug
+*       overhead measurement covers string formatting cost of debug path.
+*
+* @param[in]    fmt     - Printf style format string
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void bench_dbg_print(const char * fmt, ...)
+{
+    va_list args;
+    va_start( args, fmt );
+    vsnprintf( gs_bench_dbg_buf, sizeof( gs_bench_dbg_buf ), fmt, args );
+    va_end( args );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get monotonic host time in ns
+*
+* @return       time    - Monotonic time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ((uint64_t) ts.tv_sec * 1000000000ULL ) + (uint64_t) ts.tv_nsec;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Benchmark state handlers - minimal bodies so module overhead dominates
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_on_entry(const p_fsm_t fsm_inst)
+{
+    (void) fsm_inst;
+    gu32_bench_sink += 1U;
+}
+
+static void bench_on_activity(const p_fsm_t fsm_inst)
+{
+    (void) fsm_inst;
+    gu32_bench_sink += 1U;
+}
+
+static void bench_on_exit(const p_fsm_t fsm_inst)
+{
+    (void) fsm_inst;
+    gu32_bench_sink += 1U;
+}
+
+/**
+ *     Benchmark FSM configuration table
+ */
+static const fsm_cfg_t g_bench_fsm_cfg =
+{
+    .p_states = (fsm_state_cfg_t[])
+    {
+        [eBENCH_FSM_IDLE]   = { .on_entry=bench_on_entry, .on_activity=bench_on_activity, .on_exit=bench_on_exit, .name="IDLE", .parent=FSM_STATE_NONE },
+        [eBENCH_FSM_RUN]    = { .on_entry=bench_on_entry, .on_activity=bench_on_activity, .on_exit=bench_on_exit, .name="RUN",  .parent=FSM_STATE_NONE },
+        [eBENCH_FSM_AUX]    = { .on_entry=bench_on_entry, .on_activity=bench_on_activity, .on_exit=bench_on_exit, .name="AUX",  .parent=FSM_STATE_NONE },
+    },
+    .name   = "Bench FSM",
+    .num_of = eBENCH_FSM_NUM_OF,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Report single benchmark result and check threshold
+*
+* @param[in]    name        - Benchmark name
+* @param[in]    ns_per_call - Measured cost in ns per call
+* @param[in]    thresh_ns   - Regression threshold in ns - 0.0 when not checked
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_report(const char * name, const double ns_per_call, const double thresh_ns)
+{
+#ifdef DEBUG
+    (void) thresh_ns;
+    printf( "  %-38s %10.1f ns/call  (debug build - no threshold)\n", name, ns_per_call );
+#else
+    if (( thresh_ns > 0.0 ) && ( ns_per_call > thresh_ns ))
+    {
+        printf( "  %-38s %10.1f ns/call  FAIL (threshold %.0f ns)\n", name, ns_per_call, thresh_ns );
+        gi_bench_result = 1;
+    }
+    else
+    {
+        printf( "  %-38s %10.1f ns/call  OK\n", name, ns_per_call );
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Benchmark steady-state "fsm_hndl" cost
+*
+*       Machine stays in same state for whole run - measures pure per-call
+*       overhead of handler path without transitions.
+*
+* @return       ns_per_call - Steady-state cost in ns per call
+*/
+////////////////////////////////////////////////////////////////////////////////
+static double bench_steady_hndl(void)
+{
+    p_fsm_t fsm = NULL;
+
+    if ( eFSM_OK != fsm_init( &fsm, &g_bench_fsm_cfg ))
+    {
+        printf( "  bench init failed!\n" );
+        exit( 1 );
+    }
+
+    // Settle initial transition
+    fsm_hndl( fsm );
+
+    const uint64_t start = bench_now_ns();
+
+    for ( uint32_t it = 0U; it < BENCH_HNDL_ITERATIONS; it++ )
+    {
+        fsm_hndl( fsm );
+    }
+
+    const uint64_t stop = bench_now_ns();
+    const double ns_per_call = (double) ( stop - start ) / (double) BENCH_HNDL_ITERATIONS;
+
+    bench_report( "steady-state fsm_hndl", ns_per_call, BENCH_THRESH_HNDL_NS );
+
+    free( fsm );
+
+    return ns_per_call;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Benchmark transition cost
+*
+*       Every handler call performs transition (exit + entry + trace/history
+*       bookkeeping). Steady-state cost is subtracted so reported number is
+*       transition cost alone.
+*
+* @param[in]    steady_ns   - Measured steady-state cost in ns per call
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_transition(const double steady_ns)
+{
+    p_fsm_t fsm = NULL;
+
+    if ( eFSM_OK != fsm_init( &fsm, &g_bench_fsm_cfg ))
+    {
+        printf( "  bench init failed!\n" );
+        exit( 1 );
+    }
+
+    // Settle initial transition
+    fsm_hndl( fsm );
+
+    const uint64_t start = bench_now_ns();
+
+    for ( uint32_t it = 0U; it < BENCH_TRANS_ITERATIONS; it++ )
+    {
+        fsm_goto_state( fsm, ( it & 1U ) ? eBENCH_FSM_RUN : eBENCH_FSM_AUX );
+        fsm_hndl( fsm );
+    }
+
+    const uint64_t stop = bench_now_ns();
+    const double ns_per_call = ((double) ( stop - start ) / (double) BENCH_TRANS_ITERATIONS ) - steady_ns;
+
+    bench_report( "state transition (exit+entry+flags)", ns_per_call, BENCH_THRESH_TRANS_NS );
+
+    free( fsm );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Benchmark instance scaling
+*
+*       Services growing number of instances round-robin - once working set
+*       outgrows cache, per-call cost raises and exposes cache effects of
+*       instance layout changes.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void bench_scaling(void)
+{
+    static const uint32_t counts[] = { 1U, 10U, 100U, 1000U };
+
+    for ( uint32_t c = 0U; c < ( sizeof( counts ) / sizeof( counts[0] )); c++ )
+    {
+        const uint32_t num_of = counts[c];
+        p_fsm_t * p_insts = malloc( num_of * sizeof( p_fsm_t ));
+
+        for ( uint32_t idx = 0U; idx < num_of; idx++ )
+        {
+            if ( eFSM_OK != fsm_init( &p_insts[idx], &g_bench_fsm_cfg ))
+            {
+                printf( "  bench init failed!\n" );
+                exit( 1 );
+            }
+
+            // Settle initial transition
+            fsm_hndl( p_insts[idx] );
+        }
+
+        const uint32_t passes = BENCH_SCALE_TOTAL_CALLS / num_of;
+        const uint64_t start = bench_now_ns();
+
+        for ( uint32_t pass = 0U; pass < passes; pass++ )
+        {
+            const uint32_t tick = g_bench_tick;
+
+            for ( uint32_t idx = 0U; idx < num_of; idx++ )
+            {
+                fsm_hndl_tick( p_insts[idx], tick );
+            }
+        }
+
+        const uint64_t stop = bench_now_ns();
+        const double ns_per_call = (double) ( stop - start ) / (double) ( passes * num_of );
+
+        char name[64];
+        snprintf( name, sizeof( name ), "fsm_hndl_tick @ %u instances", num_of );
+        bench_report( name, ns_per_call, ( 1000U == num_of ) ? BENCH_THRESH_SCALE_NS : 0.0 );
+
+        for ( uint32_t idx = 0U; idx < num_of; idx++ )
+        {
+            free( p_insts[idx] );
+        }
+        free( p_insts );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Benchmark suite entry
+*
+* @return       result  - 0 on pass, 1 on threshold violation
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+#ifdef DEBUG
+    printf( "FSM benchmark suite (V%d.%d.%d) - DEBUG build\n", FSM_VER_MAJOR, FSM_VER_MINOR, FSM_VER_DEVELOP );
+    printf( "Compare against release build numbers for debug-mode overhead.\n\n" );
+#else
+    printf( "FSM benchmark suite (V%d.%d.%d) - release build\n\n", FSM_VER_MAJOR, FSM_VER_MINOR, FSM_VER_DEVELOP );
+#endif
+
+    const double steady_ns = bench_steady_hndl();
+    bench_transition( steady_ns );
+    bench_scaling();
+
+    printf( "\n%s\n", ( 0 == gi_bench_result ) ? "RESULT: PASS" : "RESULT: FAIL" );
+
+    // Prevent sink from being optimized out
+    (void) gu32_bench_sink;
+
+    return gi_bench_result;
+}
@@ -9,8 +9,8 @@
 *@email     ziga.miklosic@gmail.com
 *@author    Matej Otic
 *@email     otic.matej@dancing-bits.com
-*@date      26.09.2024
-*@version   V2.0.0
+*@date      28.08.2026
+*@version   V2.1.0
 *
 *@section Description
 *
@@ -85,6 +85,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "fsm.h"
 #include "../../fsm_cfg.h"
@@ -93,6 +94,289 @@
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ *     Maximum number of FSM instances
+ *
+ *     When set to 0 instances are allocated from heap (malloc). Setting it
+ *     above 0 reserves static pool of instances at compile time and removes
+ *     all heap usage from the module.
+ */
+#ifndef FSM_CFG_MAX_INSTANCES
+    #define FSM_CFG_MAX_INSTANCES   ( 0 )
+#endif
+
+/**
+ *     Enable/Disable resolved (branch-free) state dispatch
+ *
+ *     When enabled "fsm_init" copies state table into instance with NULL
+ *     handlers pre-substituted by shared no-op function, so hot path executes
+ *     unconditional indirect calls without NULL checks.
+ */
+#ifndef FSM_CFG_RESOLVED_DISPATCH_EN
+    #define FSM_CFG_RESOLVED_DISPATCH_EN    ( 0 )
+#endif
+
+/**
+ *     Maximum number of FSM states
+ *
+ *     Used only in resolved dispatch mode to size per-instance state table.
+ */
+#ifndef FSM_CFG_MAX_STATES
+    #define FSM_CFG_MAX_STATES      ( 8 )
+#endif
+
+/**
+ *     Size of inline user context block in bytes
+ *
+ *     When above 0 each instance carries user context block of given size,
+ *     accessible in place via "fsm_get_data_ptr" - no separately allocated
+ *     shared data struct behind "fsm_data_t.p" is needed. When 0
+ *     "fsm_get_data_ptr" returns pointer to built-in 4-byte shared data.
+ */
+#ifndef FSM_CFG_DATA_SIZE
+    #define FSM_CFG_DATA_SIZE       ( 0 )
+#endif
+
+/**
+ *     Enable/Disable hierarchical state machine support
+ *
+ *     When enabled "parent" field of state configuration is honored with
+ *     least-common-ancestor entry/exit semantics. Ancestor chains are
+ *     resolved once at init into flat per-state paths - no tree traversal
+ *     on the hot path.
+ */
+#ifndef FSM_CFG_HSM_EN
+    #define FSM_CFG_HSM_EN          ( 0 )
+#endif
+
+/**
+ *     Maximum state nesting depth in hierarchical mode (including state itself)
+ */
+#ifndef FSM_CFG_HSM_MAX_DEPTH
+    #define FSM_CFG_HSM_MAX_DEPTH   ( 4 )
+#endif
+
+/**
+ *     Number of worker partitions for registered instances
+ *
+ *     Each registered instance is pinned to one worker partition and is only
+ *     ever serviced by "fsm_hndl_worker" calls of that partition - instance
+ *     and its config stay hot in one core's cache and per-instance handlers
+ *     never run concurrently with themselves. Set to 1 for classic single
+ *     superloop servicing. Threads/tasks and per-tick barriers are owned by
+ *     application - module stays RTOS agnostic.
+ */
+#ifndef FSM_CFG_NUM_WORKERS
+    #define FSM_CFG_NUM_WORKERS     ( 1 )
+#endif
+
+#if ( FSM_CFG_NUM_WORKERS < 1 )
+    #error "FSM_CFG_NUM_WORKERS must be at least 1!"
+#endif
+
+/**
+ *     Maximum number of signal bus subscriptions
+ *
+ *     Subscriptions route publisher transitions into subscriber event queues
+ *     ("fsm_subscribe" API). Set to 0 to compile signal bus out.
+ */
+#ifndef FSM_CFG_MAX_SUBSCRIPTIONS
+    #define FSM_CFG_MAX_SUBSCRIPTIONS   ( 8 )
+#endif
+
+/**
+ *     Transition history ring size
+ *
+ *     Number of last transitions kept per instance for postmortem analysis.
+ *     Must be power of 2! Set to 0 to disable history.
+ */
+#ifndef FSM_CFG_HISTORY_SIZE
+    #define FSM_CFG_HISTORY_SIZE    ( 8 )
+#endif
+
+#if (( FSM_CFG_HISTORY_SIZE & ( FSM_CFG_HISTORY_SIZE - 1 )) != 0 )
+    #error "FSM_CFG_HISTORY_SIZE must be power of 2!"
+#endif
+
+/**
+ *     Enable/Disable per-state execution time statistics
+ *
+ *     When enabled handler executions are wrapped with timestamp sampling and
+ *     min/max/total/count statistics are accumulated per state, exposed via
+ *     "fsm_get_stats". Zero overhead when disabled.
+ */
+#ifndef FSM_CFG_STATS_EN
+    #define FSM_CFG_STATS_EN        ( 0 )
+#endif
+
+/**
+ *     High resolution timestamp for statistics
+ *
+ *     Define in fsm_cfg.h to platform cycle counter (e.g. DWT CYCCNT on
+ *     Cortex-M) - falls back to system tick when not provided.
+ */
+#ifndef FSM_GET_TIMESTAMP
+    #define FSM_GET_TIMESTAMP()     ( FSM_GET_SYSTICK())
+#endif
+
+/**
+ *     Enable/Disable binary transition trace
+ *
+ *     When enabled each transition pushes compact binary record into shared
+ *     static ring buffer at cost of couple of stores - cheap enough to stay
+ *     enabled in production. Drain records via "fsm_trace_get".
+ */
+#ifndef FSM_CFG_TRACE_EN
+    #define FSM_CFG_TRACE_EN        ( 0 )
+#endif
+
+#if ( FSM_CFG_TRACE_EN && ( FSM_CFG_NUM_WORKERS > 1 ))
+    #error "Transition trace ring is single-producer - FSM_CFG_TRACE_EN requires FSM_CFG_NUM_WORKERS == 1!"
+#endif
+
+/**
+ *     Transition trace buffer size
+ *
+ *     Number of records in shared trace ring. Must be power of 2!
+ */
+#ifndef FSM_CFG_TRACE_BUF_SIZE
+    #define FSM_CFG_TRACE_BUF_SIZE  ( 32 )
+#endif
+
+#if (( FSM_CFG_TRACE_BUF_SIZE & ( FSM_CFG_TRACE_BUF_SIZE - 1 )) != 0 )
+    #error "FSM_CFG_TRACE_BUF_SIZE must be power of 2!"
+#endif
+
+/**
+ *     Event/state request queue size
+ *
+ *     Number of items in per-instance single-producer/single-consumer queue.
+ *     Must be power of 2!
+ */
+#ifndef FSM_CFG_EVENT_QUEUE_SIZE
+    #define FSM_CFG_EVENT_QUEUE_SIZE    ( 8 )
+#endif
+
+#if (( FSM_CFG_EVENT_QUEUE_SIZE & ( FSM_CFG_EVENT_QUEUE_SIZE - 1 )) != 0 )
+    #error "FSM_CFG_EVENT_QUEUE_SIZE must be power of 2!"
+#endif
+
+/**
+ *     Memory barrier at event queue publish/consume points
+ *
+ *     Defaults to compiler barrier, which is sufficient when producer and
+ *     consumer share one core (classic ISR -> superloop posting). When
+ *     producers post from another core than one servicing the instance
+ *     (multi-core worker partitions), map in fsm_cfg.h to data memory
+ *     barrier of platform (e.g. "__DMB()" on Cortex-M,
+ *     "__sync_synchronize()" on SMP Linux) - otherwise item stores may be
+ *     reordered past the index publish on weakly-ordered cores!
+ */
+#ifndef FSM_MEMORY_BARRIER
+    #if defined(__GNUC__)
+        #define FSM_MEMORY_BARRIER()    __asm volatile ( "" ::: "memory" )
+    #else
+        #define FSM_MEMORY_BARRIER()    { ; }
+    #endif
+#endif
+
+/**
+ *     Maximum number of registered FSM instances
+ *
+ *     Registered instances are serviced together via "fsm_hndl_all". In pool
+ *     mode registry is sized after the pool, otherwise a default is used.
+ */
+#ifndef FSM_CFG_MAX_REGISTERED
+    #if ( FSM_CFG_MAX_INSTANCES > 0 )
+        #define FSM_CFG_MAX_REGISTERED  ( FSM_CFG_MAX_INSTANCES )
+    #else
+        #define FSM_CFG_MAX_REGISTERED  ( 16 )
+    #endif
+#endif
+
+/**
+ *     FSM instance memory source
+ */
+typedef enum
+{
+    eFSM_MEM_HEAP = 0,  /**<Instance allocated from heap */
+    eFSM_MEM_POOL,      /**<Instance allocated from static pool */
+    eFSM_MEM_STATIC,    /**<Instance memory provided by caller */
+} fsm_mem_t;
+
+/**
+ *     Event queue item type
+ */
+typedef enum
+{
+    eFSM_EVQ_EVENT = 0, /**<Posted event resolved via state event table */
+    eFSM_EVQ_STATE,     /**<Direct state change request */
+    eFSM_EVQ_STATE_ARG, /**<State change request with entry argument */
+} fsm_evq_type_t;
+
+/**
+ *     Event queue item
+ *
+ *     Argument slot travels with item so each queued request keeps its own
+ *     argument - shared data is not clobbered by racing requests.
+ */
+typedef struct
+{
+    uint8_t     type;   /**<Item type (fsm_evq_type_t) */
+    uint8_t     id;     /**<Event or state ID */
+    fsm_data_t  arg;    /**<Entry argument - valid for "eFSM_EVQ_STATE_ARG" items only */
+} fsm_evq_item_t;
+
+/**
+ *     Event queue
+ *
+ *     Lock-free single-producer/single-consumer ring. Producer (e.g. ISR)
+ *     writes items and advances head, consumer (FSM manager) advances tail.
+ *     No IRQ masking is needed as long as single producer posts to single
+ *     instance!
+ */
+typedef struct
+{
+    fsm_evq_item_t      items[FSM_CFG_EVENT_QUEUE_SIZE];    /**<Item storage */
+    volatile uint8_t    head;                               /**<Producer index */
+    volatile uint8_t    tail;                               /**<Consumer index */
+} fsm_evq_t;
+
+/**
+ *     State snapshot magic number ("FSMS")
+ */
+#define FSM_SNAPSHOT_MAGIC      ((uint32_t) 0x464D5353UL )
+
+/**
+ *     State snapshot layout version
+ */
+#define FSM_SNAPSHOT_VER        ((uint8_t) 0x01U )
+
+/**
+ *     State snapshot blob
+ *
+ *     Fixed layout - all members naturally aligned, no padding. Shall stay
+ *     exactly "FSM_SNAPSHOT_SIZE" bytes big on every platform! Shared data
+ *     is serialized through its 32-bit view - pointer member of "fsm_data_t"
+ *     is not meaningful across boots (and is wider than 32 bits on hosts).
+ */
+typedef struct
+{
+    uint32_t    magic;      /**<Snapshot magic number */
+    uint8_t     version;    /**<Snapshot layout version */
+    uint8_t     cur;        /**<Current state */
+    uint8_t     next;       /**<Next/Requested state */
+    uint8_t     res;        /**<Reserved for alignment */
+    uint32_t    duration;   /**<Time duration in ms */
+    uint32_t    tick_prev;  /**<Previous tick in ms */
+    uint32_t    data_u32;   /**<Data shared across states - 32-bit view */
+} fsm_snapshot_t;
+
+/**
+ *     Snapshot layout compile time guard
+ */
+typedef char fsm_snapshot_size_chk_t[( FSM_SNAPSHOT_SIZE == sizeof( fsm_snapshot_t )) ? 1 : -1];
+
 /**
  *     FSM States
  */
@@ -109,31 +393,224 @@ typedef struct
 typedef struct fsm_s
 {
     fsm_cfg_t *     p_cfg;          /**<FSM setup */
+    const fsm_state_cfg_t * p_states;   /**<Cached base pointer to state table */
     uint32_t        duration;       /**<Time duration in ms */
     uint32_t        tick_prev;      /**<Previous tick in ms, for duration calculations*/
+    uint32_t        period_ref;     /**<State duration at last periodic activity execution */
+    uint32_t        inputs;         /**<Input word evaluated against guard condition tables */
     fsm_state_t     state;          /**<Current state of FSM */
     fsm_data_t      data;           /**<Data shared across states */
+    fsm_mem_t       mem;            /**<Instance memory source */
+    fsm_evq_t       evq;            /**<Event/state request queue */
+    uint8_t         id;             /**<Instance ID - assigned in order of init */
+    uint16_t        lc;             /**<Activity handler continuation slot (FSM_YIELD/FSM_AWAIT) */
+    uint8_t         hndl_state;     /**<State whose handler is currently executing */
+    pf_overrun_t    overrun_cb;     /**<State overrun callback - optional */
+    pf_observer_t   observer;       /**<Transition observer callback - optional */
+    uint32_t        overrun_cnt;    /**<Number of state deadline overruns */
+    bool            overrun_reported;   /**<Overrun already reported for current state visit */
     bool            first_entry;    /**<First entry of state */
     bool            is_init;        /**<Initialization guard */
+    bool            cfg_cached;     /**<State table served from RAM shadow */
+    bool            time_driven;    /**<Current state has timeout/period/overrun configured */
+
+#if ( FSM_CFG_MAX_INSTANCES > 0 )
+    struct fsm_s *  p_next_free;    /**<Next free instance in pool freelist */
+#endif
+
+#if ( FSM_CFG_RESOLVED_DISPATCH_EN )
+    fsm_state_cfg_t states_resolved[FSM_CFG_MAX_STATES];    /**<State table with NULL handlers substituted by no-op */
+#endif
+
+#if ( FSM_CFG_STATS_EN )
+    fsm_stats_t     stats[FSM_CFG_MAX_STATES];  /**<Per-state execution time statistics */
+#endif
+
+#if ( FSM_CFG_HSM_EN )
+    uint8_t hsm_path[FSM_CFG_MAX_STATES][FSM_CFG_HSM_MAX_DEPTH];    /**<Root-first ancestor path of each state, incl. state itself */
+    uint8_t hsm_depth[FSM_CFG_MAX_STATES];                          /**<Ancestor path length of each state */
+#endif
+
+#if ( FSM_CFG_DATA_SIZE > 0 )
+    uint32_t data_blk[( FSM_CFG_DATA_SIZE + 3U ) / 4U]; /**<Inline user context block - 32-bit backed for alignment */
+#endif
+
+#if ( FSM_CFG_HISTORY_SIZE > 0 )
+    fsm_hist_rec_t  hist[FSM_CFG_HISTORY_SIZE]; /**<Ring of last transitions */
+    uint8_t         hist_idx;                   /**<Ring write index */
+    uint8_t         hist_cnt;                   /**<Number of valid records - saturates at ring size */
+#endif
 } fsm_t;
 
+/**
+ *     Enable/Disable fast API mode
+ *
+ *     Configuration table is fully validated once at init ("fsm_validate_cfg"),
+ *     so per-call guards of hot path APIs are redundant in correct
+ *     applications. Fast API mode folds them to constant true and lets
+ *     compiler remove them - checked behavior stays available in debug
+ *     builds via existing FSM_ASSERT pattern.
+ */
+#ifndef FSM_CFG_FAST_API_EN
+    #define FSM_CFG_FAST_API_EN     ( 0 )
+#endif
+
+/**
+ *     Per-call guard of hot path API
+ */
+#if ( FSM_CFG_FAST_API_EN )
+    #define FSM_API_CHECK(cond)     ( true )
+#else
+    #define FSM_API_CHECK(cond)     ( cond )
+#endif
+
 /**
  *     Limit loop counts
  */
 #define FSM_LIMIT_DURATION(cnt)    (( cnt >= 0x1FFFFFFFUL ) ? ( 0x1FFFFFFFUL ) : ( cnt ))
 
+/**
+ *     Execute state handler call with optional execution time measurement
+ */
+#if ( FSM_CFG_STATS_EN )
+    #define FSM_STATS_MEASURE(fsm_inst, state, call)                                                    \
+        do                                                                                              \
+        {                                                                                               \
+            const uint32_t ts_start = FSM_GET_TIMESTAMP();                                              \
+            call;                                                                                       \
+            fsm_stats_update( fsm_inst, state, (uint32_t) ( FSM_GET_TIMESTAMP() - ts_start ));          \
+        } while(0)
+#else
+    #define FSM_STATS_MEASURE(fsm_inst, state, call)    do { call; } while(0)
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
 
+#if ( FSM_CFG_MAX_INSTANCES > 0 )
+
+    /**
+     *     Static pool of FSM instances
+     */
+    static fsm_t g_fsm_pool[FSM_CFG_MAX_INSTANCES] = {0};
+
+    /**
+     *     Head of pool freelist
+     */
+    static fsm_t * gp_fsm_pool_free = NULL;
+
+    /**
+     *     Pool freelist assembled flag
+     */
+    static bool g_fsm_pool_init = false;
+
+#endif
+
+/**
+ *     Number of initialized FSM instances - used for instance ID assignment
+ */
+static uint8_t g_fsm_inst_cnt = 0U;
+
+#if ( FSM_CFG_TRACE_EN )
+
+    /**
+     *     Transition trace ring buffer
+     */
+    static fsm_trace_rec_t g_fsm_trace[FSM_CFG_TRACE_BUF_SIZE] = {0};
+
+    /**
+     *     Trace ring producer/consumer indexes
+     */
+    static volatile uint16_t g_fsm_trace_head = 0U;
+    static volatile uint16_t g_fsm_trace_tail = 0U;
+
+    /**
+     *     Number of records lost due to full trace ring
+     */
+    static volatile uint32_t g_fsm_trace_lost = 0U;
+
+#endif
+
+/**
+ *     Registry of FSM instances serviced by "fsm_hndl_all"
+ */
+static p_fsm_t g_fsm_registry[FSM_CFG_MAX_REGISTERED] = {0};
+
+/**
+ *     Worker partition of each registered FSM instance
+ */
+static uint8_t g_fsm_registry_worker[FSM_CFG_MAX_REGISTERED] = {0};
+
+#if ( FSM_CFG_MAX_SUBSCRIPTIONS > 0 )
+
+    /**
+     *     Signal bus subscription
+     */
+    typedef struct
+    {
+        p_fsm_t publisher;      /**<Instance whose transitions are published */
+        p_fsm_t subscriber;     /**<Instance receiving published transitions as events */
+        uint8_t event_base;     /**<Event ID offset in subscriber event space */
+    } fsm_sub_t;
+
+    /**
+     *     Signal bus subscription table
+     */
+    static fsm_sub_t g_fsm_subs[FSM_CFG_MAX_SUBSCRIPTIONS] = {0};
+
+    /**
+     *     Number of signal bus subscriptions
+     */
+    static uint8_t g_fsm_sub_cnt = 0U;
+
+#endif
+
+/**
+ *     Number of registered FSM instances
+ */
+static uint32_t g_fsm_registry_cnt = 0U;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static void fsm_exit_cur_state  (const p_fsm_t fsm_inst);
-static void fsm_enter_next_state(const p_fsm_t fsm_inst);
-static void fsm_handle_cur_state(const p_fsm_t fsm_inst);
-static void fsm_manager         (const p_fsm_t fsm_inst);
-static void fsm_reset_state     (const p_fsm_t fsm_inst);
+static fsm_t *      fsm_alloc           (void);
+#if ( FSM_CFG_RESOLVED_DISPATCH_EN )
+static void         fsm_state_nop       (const p_fsm_t fsm_inst);
+#endif
+static fsm_status_t fsm_validate_cfg    (const fsm_cfg_t * const p_cfg);
+static fsm_status_t fsm_init_instance   (const p_fsm_t fsm_inst, const fsm_cfg_t * const p_cfg, const fsm_mem_t mem);
+static fsm_status_t fsm_evq_push        (const p_fsm_t fsm_inst, const fsm_evq_type_t type, const uint8_t id, const fsm_data_t arg);
+static bool         fsm_evq_pop         (const p_fsm_t fsm_inst, fsm_evq_item_t * const p_item);
+static bool         fsm_evq_is_empty    (const p_fsm_t fsm_inst);
+static void         fsm_process_events  (const p_fsm_t fsm_inst);
+static void         fsm_process_guards  (const p_fsm_t fsm_inst);
+static void         fsm_update_time_driven(const p_fsm_t fsm_inst);
+#if ( FSM_CFG_MAX_SUBSCRIPTIONS > 0 )
+static void         fsm_signal_publish  (const p_fsm_t fsm_inst, const uint8_t to);
+#endif
+#if ( FSM_CFG_STATS_EN )
+static void         fsm_stats_update    (const p_fsm_t fsm_inst, const uint8_t state, const uint32_t time);
+#endif
+#if ( FSM_CFG_TRACE_EN )
+static void         fsm_trace_push      (const p_fsm_t fsm_inst, const uint8_t from, const uint8_t to, const uint32_t tick);
+#endif
+#if ( FSM_CFG_HISTORY_SIZE > 0 )
+static void         fsm_hist_push       (const p_fsm_t fsm_inst, const uint8_t from, const uint8_t to, const uint32_t tick);
+#endif
+#if ( FSM_CFG_HSM_EN )
+static fsm_status_t fsm_hsm_resolve_paths   (const p_fsm_t fsm_inst, const fsm_cfg_t * const p_cfg);
+static void         fsm_call_on_entry       (const p_fsm_t fsm_inst, const uint8_t state);
+static void         fsm_call_on_exit        (const p_fsm_t fsm_inst, const uint8_t state);
+static void         fsm_hsm_enter_chain     (const p_fsm_t fsm_inst, const uint32_t tick, const uint8_t from_level);
+static void         fsm_hsm_transition      (const p_fsm_t fsm_inst, const uint32_t tick);
+#else
+static void         fsm_exit_cur_state  (const p_fsm_t fsm_inst);
+static void         fsm_enter_next_state(const p_fsm_t fsm_inst, const uint32_t tick);
+#endif
+static void         fsm_handle_cur_state(const p_fsm_t fsm_inst, const uint32_t tick);
+static void         fsm_manager         (const p_fsm_t fsm_inst, const uint32_t tick);
+static void         fsm_reset_state     (const p_fsm_t fsm_inst);
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -141,457 +618,2780 @@ static void fsm_reset_state     (const p_fsm_t fsm_inst);
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Exit current FSM state by calling its exit function
+*       Allocate FSM instance
 *
-* @param[in]    fsm_inst    - FSM instance
-* @return       void
+*       In pool mode (FSM_CFG_MAX_INSTANCES > 0) instance is taken from static
+*       pool freelist in O(1), otherwise it is allocated from heap.
+*
+* @return       p_inst - Pointer to allocated instance, NULL when exhausted
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void fsm_exit_cur_state(const p_fsm_t fsm_inst)
+static fsm_t * fsm_alloc(void)
 {
-    // Execute on exit actions
-    if ( NULL != fsm_inst->p_cfg->p_states[fsm_inst->state.cur].on_exit )
+    fsm_t * p_inst = NULL;
+
+#if ( FSM_CFG_MAX_INSTANCES > 0 )
+
+    // Assemble freelist on first allocation
+    if ( false == g_fsm_pool_init )
+    {
+        for ( uint32_t idx = 0U; idx < ( FSM_CFG_MAX_INSTANCES - 1U ); idx++ )
+        {
+            g_fsm_pool[idx].p_next_free = &g_fsm_pool[idx+1U];
+        }
+        g_fsm_pool[FSM_CFG_MAX_INSTANCES-1U].p_next_free = NULL;
+
+        gp_fsm_pool_free = &g_fsm_pool[0];
+        g_fsm_pool_init = true;
+    }
+
+    // Pop head of freelist
+    if ( NULL != gp_fsm_pool_free )
     {
-        fsm_inst->p_cfg->p_states[fsm_inst->state.cur].on_exit(fsm_inst);
+        p_inst = gp_fsm_pool_free;
+        gp_fsm_pool_free = p_inst->p_next_free;
+        p_inst->p_next_free = NULL;
     }
+
+#else
+    p_inst = malloc( sizeof( fsm_t ));
+#endif
+
+    return p_inst;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Enter next FSM state by calling its entry function
+*       Validate FSM configuration table
 *
-*       This function resets state duration before entry is executed.
+*       Full one-time verification at init: states pointer, state count and
+*       all transition targets (timeout, event tables, guards) are checked in
+*       range, so runtime code may trust configuration without re-checking on
+*       every call (see FSM_CFG_FAST_API_EN).
 *
-* @param[in]    fsm_inst    - FSM instance
-* @return       void
+* @param[in]    p_cfg       - Pointer to FSM configuration table
+* @return       status      - Status of validation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void fsm_enter_next_state(const p_fsm_t fsm_inst)
+static fsm_status_t fsm_validate_cfg(const fsm_cfg_t * const p_cfg)
 {
-    fsm_inst->tick_prev = FSM_GET_SYSTICK();
-    fsm_inst->duration = 0.0f; // Make sure when state entry is executed duration is 0
+    fsm_status_t status = eFSM_OK;
 
-    // Execute on entry actions
-    if ( NULL != fsm_inst->p_cfg->p_states[fsm_inst->state.next].on_entry )
+    FSM_ASSERT( NULL != p_cfg->p_states );
+    FSM_ASSERT( p_cfg->num_of > 0 );
+
+    if  (   ( NULL == p_cfg->p_states )
+        ||  ( 0U == p_cfg->num_of ))
     {
-        fsm_inst->p_cfg->p_states[fsm_inst->state.next].on_entry(fsm_inst);
+        status = eFSM_ERROR_INIT;
     }
 
-    fsm_inst->state.cur = fsm_inst->state.next;
+#if ( FSM_CFG_RESOLVED_DISPATCH_EN || FSM_CFG_STATS_EN || FSM_CFG_HSM_EN )
+    FSM_ASSERT( p_cfg->num_of <= FSM_CFG_MAX_STATES );
+
+    if ( p_cfg->num_of > FSM_CFG_MAX_STATES )
+    {
+        status = eFSM_ERROR_INIT;
+    }
+#endif
+
+    // Validate per-state configuration - targets of timeouts, events and
+    // guards shall all be in range
+    if ( eFSM_OK == status )
+    {
+        for ( uint8_t state = 0U; state < p_cfg->num_of; state++ )
+        {
+            const fsm_state_cfg_t * p_state = &p_cfg->p_states[state];
+
+            // Timeout target in range
+            if  (   ( p_state->timeout_ms > 0U )
+                &&  ( p_state->timeout_state >= p_cfg->num_of ))
+            {
+                status = eFSM_ERROR_INIT;
+                break;
+            }
+
+            // Event table entries in range
+            if ( NULL != p_state->p_events )
+            {
+                if ( 0U == p_cfg->num_of_events )
+                {
+                    status = eFSM_ERROR_INIT;
+                    break;
+                }
+
+                for ( uint8_t event = 0U; event < p_cfg->num_of_events; event++ )
+                {
+                    if  (   ( FSM_EVENT_IGNORE != p_state->p_events[event] )
+                        &&  ( p_state->p_events[event] >= p_cfg->num_of ))
+                    {
+                        status = eFSM_ERROR_INIT;
+                        break;
+                    }
+                }
+            }
+
+            // Guard targets in range
+            if ( NULL != p_state->p_guards )
+            {
+                for ( uint8_t guard = 0U; guard < p_state->num_of_guards; guard++ )
+                {
+                    if ( p_state->p_guards[guard].next_state >= p_cfg->num_of )
+                    {
+                        status = eFSM_ERROR_INIT;
+                        break;
+                    }
+                }
+            }
+
+            if ( eFSM_OK != status )
+            {
+                break;
+            }
+        }
+    }
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Handle current FSM state by calling its activity function
-*
-*       This function increments state duration and saturates it before activity
-*       is executed.
+*       Initialize FSM instance data
 *
 * @param[in]    fsm_inst    - FSM instance
-* @return       void
+* @param[in]    p_cfg       - Pointer to FSM configuration table
+* @param[in]    mem         - Instance memory source
+* @return       status      - Status of initialization
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void fsm_handle_cur_state(const p_fsm_t fsm_inst)
+static fsm_status_t fsm_init_instance(const p_fsm_t fsm_inst, const fsm_cfg_t * const p_cfg, const fsm_mem_t mem)
 {
-    // Accumulate time
-    const uint32_t tick_now = FSM_GET_SYSTICK();
-    fsm_inst->duration += (uint32_t) ( tick_now - fsm_inst->tick_prev );
-    fsm_inst->duration = FSM_LIMIT_DURATION( fsm_inst->duration );
-    fsm_inst->tick_prev = tick_now;
+    fsm_status_t status = eFSM_OK;
 
-    // Execute current state
-    if ( NULL != fsm_inst->p_cfg->p_states[fsm_inst->state.cur].on_activity )
+    // Validate configuration fully - once and for all, per-call guards can
+    // be compiled out in fast API mode
+    status = fsm_validate_cfg( p_cfg );
+
+    if ( eFSM_OK == status )
+    {
+        // Get setup
+        fsm_inst->p_cfg = (fsm_cfg_t*) p_cfg;
+        fsm_inst->mem = mem;
+
+        // Assign instance ID in order of init
+        fsm_inst->id = g_fsm_inst_cnt;
+        g_fsm_inst_cnt++;
+
+        // No callbacks until registered
+        fsm_inst->overrun_cb = NULL;
+        fsm_inst->observer = NULL;
+
+    #if ( FSM_CFG_RESOLVED_DISPATCH_EN )
+
+        // Copy state table into instance with NULL handlers resolved to no-op
+        for ( uint8_t state = 0U; state < p_cfg->num_of; state++ )
+        {
+            fsm_inst->states_resolved[state] = p_cfg->p_states[state];
+
+            if ( NULL == fsm_inst->states_resolved[state].on_entry )    { fsm_inst->states_resolved[state].on_entry    = fsm_state_nop; }
+            if ( NULL == fsm_inst->states_resolved[state].on_activity ) { fsm_inst->states_resolved[state].on_activity = fsm_state_nop; }
+            if ( NULL == fsm_inst->states_resolved[state].on_exit )     { fsm_inst->states_resolved[state].on_exit     = fsm_state_nop; }
+        }
+
+        fsm_inst->p_states = &fsm_inst->states_resolved[0];
+
+        // Resolved table lives inside instance - already RAM resident
+        fsm_inst->cfg_cached = true;
+
+    #else
+        fsm_inst->p_states = p_cfg->p_states;
+        fsm_inst->cfg_cached = false;
+    #endif
+
+    #if ( FSM_CFG_HSM_EN )
+
+        // Flatten state hierarchy into per-state ancestor paths
+        status = fsm_hsm_resolve_paths( fsm_inst, p_cfg );
+
+        if ( eFSM_OK == status )
+        {
+            // Init FSM to default
+            fsm_reset_state( fsm_inst );
+        }
+
+    #else
+        // Init FSM to default
+        fsm_reset_state( fsm_inst );
+    #endif
+    }
+    else
     {
-        fsm_inst->p_cfg->p_states[fsm_inst->state.cur].on_activity(fsm_inst);
+        status = eFSM_ERROR_INIT;
     }
+
+    return status;
 }
 
+#if ( FSM_CFG_RESOLVED_DISPATCH_EN )
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       FSM manager
+*       Shared no-op state function
+*
+*       Substituted for NULL handlers in resolved dispatch mode, so hot path
+*       performs unconditional indirect calls without data-dependent branches.
 *
 * @param[in]    fsm_inst    - FSM instance
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void fsm_manager(const p_fsm_t fsm_inst)
+static void fsm_state_nop(const p_fsm_t fsm_inst)
 {
-    // Initial state
-    if (fsm_inst->state.is_init)
-    {
-        #if ( FSM_CFG_DEBUG_EN )
-            if (NULL != fsm_inst->p_cfg->name)
-            {
-                if  ( NULL != fsm_inst->p_cfg->p_states[fsm_inst->state.next].name )
-                {
-                    FSM_DBG_PRINT( "%s transition: 'initial' -> %s", fsm_inst->p_cfg->name, fsm_inst->p_cfg->p_states[fsm_inst->state.next].name );
-                }
-                else
-                {
-                    FSM_DBG_PRINT( "%s transition: initial -> %d", fsm_inst->p_cfg->name, fsm_inst->state.next );
-                }
-            }
-        #endif
+    (void) fsm_inst;
+}
+#endif
 
-        fsm_inst->state.is_init = false;
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Push item to FSM event queue
+*
+*       Wait-free producer side of SPSC ring - safe to call from interrupt
+*       context without IRQ masking. Publish/consume points are fenced with
+*       "FSM_MEMORY_BARRIER" - map it to hardware barrier when producer runs
+*       on different core than consumer!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    type        - Item type
+* @param[in]    id          - Event or state ID
+* @param[in]    arg         - Entry argument - used for "eFSM_EVQ_STATE_ARG" items only
+* @return       status      - Status of operation, error when queue is full
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fsm_status_t fsm_evq_push(const p_fsm_t fsm_inst, const fsm_evq_type_t type, const uint8_t id, const fsm_data_t arg)
+{
+    fsm_status_t status = eFSM_OK;
 
-        // Execute entry of next state only; initial state does not have an exit activity
-        fsm_enter_next_state(fsm_inst);
-    }
+    const uint8_t head = fsm_inst->evq.head;
+    const uint8_t next = (uint8_t) (( head + 1U ) & ( FSM_CFG_EVENT_QUEUE_SIZE - 1U ));
 
-    // State change
-    else if ( fsm_inst->state.cur != fsm_inst->state.next )
+    if ( next != fsm_inst->evq.tail )
     {
-        #if ( FSM_CFG_DEBUG_EN )
-            if (NULL != fsm_inst->p_cfg->name)
-            {
-                if  (   ( NULL != fsm_inst->p_cfg->p_states[fsm_inst->state.cur].name )
-                    &&  ( NULL != fsm_inst->p_cfg->p_states[fsm_inst->state.next].name ))
-                {
-                    FSM_DBG_PRINT( "%s transition: %s -> %s", fsm_inst->p_cfg->name, fsm_inst->p_cfg->p_states[fsm_inst->state.cur].name, fsm_inst->p_cfg->p_states[fsm_inst->state.next].name );
-                }
-                else
-                {
-                    FSM_DBG_PRINT( "%s transition: %d -> %d", fsm_inst->p_cfg->name, fsm_inst->state.cur, fsm_inst->state.next );
-                }
-            }
+        fsm_inst->evq.items[head].type = (uint8_t) type;
+        fsm_inst->evq.items[head].id = id;
+        fsm_inst->evq.items[head].arg = arg;
+
+        // Publish item by advancing head after item is fully written
+        FSM_MEMORY_BARRIER();
+        fsm_inst->evq.head = next;
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Pop item from FSM event queue
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[out]   p_item      - Popped item
+* @return       popped      - True when item was popped, false on empty queue
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fsm_evq_pop(const p_fsm_t fsm_inst, fsm_evq_item_t * const p_item)
+{
+    bool popped = false;
+
+    const uint8_t tail = fsm_inst->evq.tail;
+
+    if ( tail != fsm_inst->evq.head )
+    {
+        // Read item only after observing published head
+        FSM_MEMORY_BARRIER();
+        *p_item = fsm_inst->evq.items[tail];
+
+        // Release item slot back to producer after item is fully read
+        FSM_MEMORY_BARRIER();
+        fsm_inst->evq.tail = (uint8_t) (( tail + 1U ) & ( FSM_CFG_EVENT_QUEUE_SIZE - 1U ));
+        popped = true;
+    }
+
+    return popped;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Is FSM event queue empty
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       empty       - True when queue holds no items
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool fsm_evq_is_empty(const p_fsm_t fsm_inst)
+{
+    return ( fsm_inst->evq.head == fsm_inst->evq.tail );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Process pending FSM events/state requests
+*
+*       Drains queue until first item that triggers transition - remaining
+*       items are left for following handler calls so each transition gets its
+*       own exit/entry pass. Events that current state does not react to are
+*       discarded.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_process_events(const p_fsm_t fsm_inst)
+{
+    fsm_evq_item_t item = {0};
+
+    while ( true == fsm_evq_pop( fsm_inst, &item ))
+    {
+        if  (   ( eFSM_EVQ_STATE == (fsm_evq_type_t) item.type )
+            ||  ( eFSM_EVQ_STATE_ARG == (fsm_evq_type_t) item.type ))
+        {
+            if ( item.id < fsm_inst->p_cfg->num_of )
+            {
+                // Deliver latched argument into shared data right before
+                // entry of requested state executes
+                if ( eFSM_EVQ_STATE_ARG == (fsm_evq_type_t) item.type )
+                {
+                    fsm_inst->data = item.arg;
+                }
+
+                fsm_inst->state.next = item.id;
+                break;
+            }
+        }
+        else
+        {
+            const uint8_t * p_events = fsm_inst->p_states[fsm_inst->state.cur].p_events;
+
+            if ( NULL != p_events )
+            {
+                const uint8_t next = p_events[item.id];
+
+                if  (   ( FSM_EVENT_IGNORE != next )
+                    &&  ( next < fsm_inst->p_cfg->num_of ))
+                {
+                    fsm_inst->state.next = next;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Evaluate guard condition table of current state
+*
+*       Masked compares of instance input word against guard table of current
+*       state - one AND+CMP per candidate transition on register-resident
+*       word. First matching guard wins. Skipped when transition is already
+*       pending so event/request resolution keeps priority.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_process_guards(const p_fsm_t fsm_inst)
+{
+    const fsm_state_cfg_t * p_state = &fsm_inst->p_states[fsm_inst->state.cur];
+
+    if  (   ( NULL != p_state->p_guards )
+        &&  ( fsm_inst->state.cur == fsm_inst->state.next ))
+    {
+        const uint32_t inputs = fsm_inst->inputs;
+
+        for ( uint8_t idx = 0U; idx < p_state->num_of_guards; idx++ )
+        {
+            const fsm_guard_t * p_guard = &p_state->p_guards[idx];
+
+            if (( inputs & p_guard->mask ) == p_guard->value )
+            {
+                if ( p_guard->next_state < fsm_inst->p_cfg->num_of )
+                {
+                    fsm_inst->state.next = p_guard->next_state;
+                }
+
+                break;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Refresh time driven flag of current state
+*
+*       Cached on every state change so event driven skip in handler stays a
+*       single flag load: states with timeout, periodic activity or deadline
+*       overrun configured must keep being serviced by time even when no event
+*       pends.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_update_time_driven(const p_fsm_t fsm_inst)
+{
+    const fsm_state_cfg_t * p_state = &fsm_inst->p_states[fsm_inst->state.cur];
+
+    fsm_inst->time_driven = ( 0U != ( p_state->timeout_ms | p_state->period_ms | p_state->max_duration_ms ));
+}
+
+#if ( FSM_CFG_MAX_SUBSCRIPTIONS > 0 )
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Publish transition to signal bus subscribers
+*
+*       Pushes entered state as event ("event_base" + state) into event queue
+*       of every subscriber of transitioning instance - couple of stores per
+*       subscriber, no copies. Subscribers resolve it via their own event
+*       lookup tables on next handler call, replacing cross-machine
+*       "fsm_get_state" polling.
+*
+* @param[in]    fsm_inst    - Transitioning (publishing) FSM instance
+* @param[in]    to          - Entered state
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_signal_publish(const p_fsm_t fsm_inst, const uint8_t to)
+{
+    for ( uint8_t idx = 0U; idx < g_fsm_sub_cnt; idx++ )
+    {
+        const fsm_sub_t * p_sub = &g_fsm_subs[idx];
+
+        if ( fsm_inst == p_sub->publisher )
+        {
+            const uint8_t event = (uint8_t) ( p_sub->event_base + to );
+
+            // Events outside subscriber event space are discarded
+            if ( event < p_sub->subscriber->p_cfg->num_of_events )
+            {
+                (void) fsm_evq_push( p_sub->subscriber, eFSM_EVQ_EVENT, event, (fsm_data_t) { .u32 = 0U } );
+            }
+        }
+    }
+}
+#endif
+
+#if ( FSM_CFG_TRACE_EN )
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Push transition record to trace ring
+*
+*       Couple of stores per transition - no formatting, no I/O. Records are
+*       dropped (and counted) when ring is full, background drain via
+*       "fsm_trace_get" shall keep up with transition rate.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    from        - Exited state
+* @param[in]    to          - Entered state
+* @param[in]    tick        - Current system tick in ms
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_trace_push(const p_fsm_t fsm_inst, const uint8_t from, const uint8_t to, const uint32_t tick)
+{
+    const uint16_t head = g_fsm_trace_head;
+    const uint16_t next = (uint16_t) (( head + 1U ) & ( FSM_CFG_TRACE_BUF_SIZE - 1U ));
+
+    if ( next != g_fsm_trace_tail )
+    {
+        g_fsm_trace[head].inst_id = fsm_inst->id;
+        g_fsm_trace[head].from = from;
+        g_fsm_trace[head].to = to;
+        g_fsm_trace[head].res = 0U;
+        g_fsm_trace[head].tick = tick;
+
+        // Publish record by advancing head after record is fully written
+        g_fsm_trace_head = next;
+    }
+    else
+    {
+        g_fsm_trace_lost++;
+    }
+}
+#endif
+
+#if ( FSM_CFG_HISTORY_SIZE > 0 )
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Push transition record to per-instance history ring
+*
+*       Overwrites oldest record when ring is full - last N transitions are
+*       always available for postmortem analysis without any I/O or draining.
+*       Three byte-size stores per transition.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    from        - Exited state
+* @param[in]    to          - Entered state
+* @param[in]    tick        - Current system tick in ms
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_hist_push(const p_fsm_t fsm_inst, const uint8_t from, const uint8_t to, const uint32_t tick)
+{
+    const uint8_t idx = fsm_inst->hist_idx;
+
+    fsm_inst->hist[idx].from = from;
+    fsm_inst->hist[idx].to = to;
+    fsm_inst->hist[idx].tick = (uint16_t) tick;
+
+    fsm_inst->hist_idx = (uint8_t) (( idx + 1U ) & ( FSM_CFG_HISTORY_SIZE - 1U ));
+
+    if ( fsm_inst->hist_cnt < FSM_CFG_HISTORY_SIZE )
+    {
+        fsm_inst->hist_cnt++;
+    }
+}
+#endif
+
+#if ( FSM_CFG_STATS_EN )
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Update per-state execution time statistics
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    state       - Measured state
+* @param[in]    time        - Handler execution time
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_stats_update(const p_fsm_t fsm_inst, const uint8_t state, const uint32_t time)
+{
+    fsm_stats_t * p_stats = &fsm_inst->stats[state];
+
+    if ( time < p_stats->min )
+    {
+        p_stats->min = time;
+    }
+
+    if ( time > p_stats->max )
+    {
+        p_stats->max = time;
+    }
+
+    p_stats->total += time;
+    p_stats->cnt++;
+}
+#endif
+
+#if ( FSM_CFG_HSM_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Resolve ancestor chains into flat per-state paths
+*
+*       Executed once at init so runtime transitions are plain array walks
+*       without tree traversal or recursion.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    p_cfg       - Pointer to FSM configuration table
+* @return       status      - Status of resolution, error on invalid parent,
+*                             exceeded depth or parent cycle
+*/
+////////////////////////////////////////////////////////////////////////////////
+static fsm_status_t fsm_hsm_resolve_paths(const p_fsm_t fsm_inst, const fsm_cfg_t * const p_cfg)
+{
+    fsm_status_t status = eFSM_OK;
+
+    for ( uint8_t state = 0U; state < p_cfg->num_of; state++ )
+    {
+        uint8_t chain[FSM_CFG_HSM_MAX_DEPTH];
+        uint8_t depth = 0U;
+        uint8_t walk = state;
+
+        // Walk towards root - at most max depth steps
+        while   (   ( FSM_STATE_NONE != walk )
+                &&  ( walk < p_cfg->num_of )
+                &&  ( depth < FSM_CFG_HSM_MAX_DEPTH ))
+        {
+            chain[depth] = walk;
+            depth++;
+            walk = p_cfg->p_states[walk].parent;
+        }
+
+        // Root not reached -> invalid parent, cycle or too deep nesting
+        if ( FSM_STATE_NONE != walk )
+        {
+            FSM_ASSERT(0); // CONFIG ERROR: Invalid state hierarchy!
+            status = eFSM_ERROR_INIT;
+            break;
+        }
+
+        // Store path root-first
+        for ( uint8_t lvl = 0U; lvl < depth; lvl++ )
+        {
+            fsm_inst->hsm_path[state][lvl] = chain[depth - 1U - lvl];
+        }
+
+        fsm_inst->hsm_depth[state] = depth;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Execute entry function of given state
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    state       - Entered state
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_call_on_entry(const p_fsm_t fsm_inst, const uint8_t state)
+{
+    fsm_inst->hndl_state = state;
+
+#if ( FSM_CFG_RESOLVED_DISPATCH_EN )
+    FSM_STATS_MEASURE( fsm_inst, state, fsm_inst->p_states[state].on_entry(fsm_inst));
+#else
+    if ( NULL != fsm_inst->p_states[state].on_entry )
+    {
+        FSM_STATS_MEASURE( fsm_inst, state, fsm_inst->p_states[state].on_entry(fsm_inst));
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Execute exit function of given state
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    state       - Exited state
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_call_on_exit(const p_fsm_t fsm_inst, const uint8_t state)
+{
+    fsm_inst->hndl_state = state;
+
+#if ( FSM_CFG_RESOLVED_DISPATCH_EN )
+    FSM_STATS_MEASURE( fsm_inst, state, fsm_inst->p_states[state].on_exit(fsm_inst));
+#else
+    if ( NULL != fsm_inst->p_states[state].on_exit )
+    {
+        FSM_STATS_MEASURE( fsm_inst, state, fsm_inst->p_states[state].on_exit(fsm_inst));
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Enter next FSM state by executing entry chain from given level down
+*
+*       This function resets state duration before entries are executed.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    tick        - Current system tick in ms
+* @param[in]    from_level  - Path level to start entries from (0 = root)
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_hsm_enter_chain(const p_fsm_t fsm_inst, const uint32_t tick, const uint8_t from_level)
+{
+    const uint8_t next = fsm_inst->state.next;
+
+    fsm_inst->tick_prev = tick;
+    fsm_inst->duration = 0U; // Make sure when state entry is executed duration is 0
+    fsm_inst->period_ref = 0U;
+    fsm_inst->overrun_reported = false;
+
+    // Enter ancestors down to target state
+    for ( uint8_t lvl = from_level; lvl < fsm_inst->hsm_depth[next]; lvl++ )
+    {
+        fsm_call_on_entry( fsm_inst, fsm_inst->hsm_path[next][lvl] );
+    }
+
+    fsm_inst->state.cur = next;
+
+    fsm_update_time_driven( fsm_inst );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Execute hierarchical state transition
+*
+*       Exits current state chain up to (excluding) least common ancestor of
+*       both states and enters next state chain down from there. O(depth)
+*       array walk - ancestor paths were flattened at init.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    tick        - Current system tick in ms
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_hsm_transition(const p_fsm_t fsm_inst, const uint32_t tick)
+{
+    const uint8_t cur = fsm_inst->state.cur;
+    const uint8_t next = fsm_inst->state.next;
+    uint8_t lca = 0U;
+
+    // Longest common root-first path prefix
+    while   (   ( lca < fsm_inst->hsm_depth[cur] )
+            &&  ( lca < fsm_inst->hsm_depth[next] )
+            &&  ( fsm_inst->hsm_path[cur][lca] == fsm_inst->hsm_path[next][lca] ))
+    {
+        lca++;
+    }
+
+    // Transition to own ancestor/descendant - step one level up so source
+    // exit and target entry still execute
+    if  (   ( lca >= fsm_inst->hsm_depth[cur] )
+        ||  ( lca >= fsm_inst->hsm_depth[next] ))
+    {
+        if ( lca > 0U )
+        {
+            lca--;
+        }
+    }
+
+    // Exit current chain up to least common ancestor
+    for ( uint8_t lvl = fsm_inst->hsm_depth[cur]; lvl > lca; lvl-- )
+    {
+        fsm_call_on_exit( fsm_inst, fsm_inst->hsm_path[cur][lvl - 1U] );
+    }
+
+    // Enter next chain down from least common ancestor
+    fsm_hsm_enter_chain( fsm_inst, tick, lca );
+}
+
+#else
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Exit current FSM state by calling its exit function
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_exit_cur_state(const p_fsm_t fsm_inst)
+{
+    fsm_inst->hndl_state = fsm_inst->state.cur;
+
+    // Execute on exit actions
+#if ( FSM_CFG_RESOLVED_DISPATCH_EN )
+    FSM_STATS_MEASURE( fsm_inst, fsm_inst->state.cur, fsm_inst->p_states[fsm_inst->state.cur].on_exit(fsm_inst));
+#else
+    if ( NULL != fsm_inst->p_states[fsm_inst->state.cur].on_exit )
+    {
+        FSM_STATS_MEASURE( fsm_inst, fsm_inst->state.cur, fsm_inst->p_states[fsm_inst->state.cur].on_exit(fsm_inst));
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Enter next FSM state by calling its entry function
+*
+*       This function resets state duration before entry is executed.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    tick        - Current system tick in ms
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_enter_next_state(const p_fsm_t fsm_inst, const uint32_t tick)
+{
+    fsm_inst->tick_prev = tick;
+    fsm_inst->duration = 0U; // Make sure when state entry is executed duration is 0
+    fsm_inst->period_ref = 0U;
+    fsm_inst->overrun_reported = false;
+    fsm_inst->hndl_state = fsm_inst->state.next;
+
+    // Execute on entry actions
+#if ( FSM_CFG_RESOLVED_DISPATCH_EN )
+    FSM_STATS_MEASURE( fsm_inst, fsm_inst->state.next, fsm_inst->p_states[fsm_inst->state.next].on_entry(fsm_inst));
+#else
+    if ( NULL != fsm_inst->p_states[fsm_inst->state.next].on_entry )
+    {
+        FSM_STATS_MEASURE( fsm_inst, fsm_inst->state.next, fsm_inst->p_states[fsm_inst->state.next].on_entry(fsm_inst));
+    }
+#endif
+
+    fsm_inst->state.cur = fsm_inst->state.next;
+
+    fsm_update_time_driven( fsm_inst );
+}
+
+#endif // FSM_CFG_HSM_EN
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle current FSM state by calling its activity function
+*
+*       This function increments state duration and saturates it before activity
+*       is executed.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    tick        - Current system tick in ms
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_handle_cur_state(const p_fsm_t fsm_inst, const uint32_t tick)
+{
+    const fsm_state_cfg_t * p_state = &fsm_inst->p_states[fsm_inst->state.cur];
+
+    // Accumulate time
+    fsm_inst->duration += (uint32_t) ( tick - fsm_inst->tick_prev );
+    fsm_inst->duration = FSM_LIMIT_DURATION( fsm_inst->duration );
+    fsm_inst->tick_prev = tick;
+
+    // State deadline overrun -> count and report once per state visit
+    if  (   ( p_state->max_duration_ms > 0U )
+        &&  ( fsm_inst->duration > p_state->max_duration_ms )
+        &&  ( false == fsm_inst->overrun_reported ))
+    {
+        fsm_inst->overrun_cnt++;
+        fsm_inst->overrun_reported = true;
+
+        if ( NULL != fsm_inst->overrun_cb )
+        {
+            fsm_inst->overrun_cb( fsm_inst, fsm_inst->state.cur, fsm_inst->duration );
+        }
+    }
+
+    // State timeout elapsed -> request transition to timeout state
+    if  (   ( p_state->timeout_ms > 0U )
+        &&  ( fsm_inst->duration >= p_state->timeout_ms )
+        &&  ( p_state->timeout_state < fsm_inst->p_cfg->num_of ))
+    {
+        fsm_inst->state.next = p_state->timeout_state;
+    }
+
+    // Honor activity execution period when configured
+    if ( p_state->period_ms > 0U )
+    {
+        if  (   ( true == fsm_inst->first_entry )
+            ||  (( fsm_inst->duration - fsm_inst->period_ref ) >= p_state->period_ms ))
+        {
+            fsm_inst->period_ref = fsm_inst->duration;
+        }
+        else
+        {
+            // Period not yet elapsed
+            return;
+        }
+    }
+
+    // Execute current state
+    fsm_inst->hndl_state = fsm_inst->state.cur;
+
+#if ( FSM_CFG_RESOLVED_DISPATCH_EN )
+    FSM_STATS_MEASURE( fsm_inst, fsm_inst->state.cur, p_state->on_activity(fsm_inst));
+#else
+    if ( NULL != p_state->on_activity )
+    {
+        FSM_STATS_MEASURE( fsm_inst, fsm_inst->state.cur, p_state->on_activity(fsm_inst));
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       FSM manager
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    tick        - Current system tick in ms
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_manager(const p_fsm_t fsm_inst, const uint32_t tick)
+{
+    // Resolve pending event into next state
+    fsm_process_events(fsm_inst);
+
+    // Evaluate guard conditions of current state
+    if ( false == fsm_inst->state.is_init )
+    {
+        fsm_process_guards(fsm_inst);
+    }
+
+    // Initial state
+    if (fsm_inst->state.is_init)
+    {
+        #if ( FSM_CFG_DEBUG_EN )
+            if (NULL != fsm_inst->p_cfg->name)
+            {
+                if  ( NULL != fsm_inst->p_cfg->p_states[fsm_inst->state.next].name )
+                {
+                    FSM_DBG_PRINT( "%s transition: 'initial' -> %s", fsm_inst->p_cfg->name, fsm_inst->p_cfg->p_states[fsm_inst->state.next].name );
+                }
+                else
+                {
+                    FSM_DBG_PRINT( "%s transition: initial -> %d", fsm_inst->p_cfg->name, fsm_inst->state.next );
+                }
+            }
+        #endif
+
+        #if ( FSM_CFG_TRACE_EN )
+            fsm_trace_push( fsm_inst, FSM_STATE_NONE, fsm_inst->state.next, tick );
+        #endif
+
+        #if ( FSM_CFG_HISTORY_SIZE > 0 )
+            fsm_hist_push( fsm_inst, FSM_STATE_NONE, fsm_inst->state.next, tick );
+        #endif
+
+        // Notify observer
+        if ( NULL != fsm_inst->observer )
+        {
+            fsm_inst->observer( fsm_inst->id, FSM_STATE_NONE, fsm_inst->state.next, tick );
+        }
+
+        #if ( FSM_CFG_MAX_SUBSCRIPTIONS > 0 )
+            fsm_signal_publish( fsm_inst, fsm_inst->state.next );
+        #endif
+
+        fsm_inst->state.is_init = false;
+
+        // Execute entry of next state only; initial state does not have an exit activity
+        #if ( FSM_CFG_HSM_EN )
+            fsm_hsm_enter_chain(fsm_inst, tick, 0U);
+        #else
+            fsm_enter_next_state(fsm_inst, tick);
+        #endif
+    }
+
+    // State change
+    else if ( fsm_inst->state.cur != fsm_inst->state.next )
+    {
+        #if ( FSM_CFG_DEBUG_EN )
+            if (NULL != fsm_inst->p_cfg->name)
+            {
+                if  (   ( NULL != fsm_inst->p_cfg->p_states[fsm_inst->state.cur].name )
+                    &&  ( NULL != fsm_inst->p_cfg->p_states[fsm_inst->state.next].name ))
+                {
+                    FSM_DBG_PRINT( "%s transition: %s -> %s", fsm_inst->p_cfg->name, fsm_inst->p_cfg->p_states[fsm_inst->state.cur].name, fsm_inst->p_cfg->p_states[fsm_inst->state.next].name );
+                }
+                else
+                {
+                    FSM_DBG_PRINT( "%s transition: %d -> %d", fsm_inst->p_cfg->name, fsm_inst->state.cur, fsm_inst->state.next );
+                }
+            }
+        #endif
+
+        #if ( FSM_CFG_TRACE_EN )
+            fsm_trace_push( fsm_inst, fsm_inst->state.cur, fsm_inst->state.next, tick );
+        #endif
+
+        #if ( FSM_CFG_HISTORY_SIZE > 0 )
+            fsm_hist_push( fsm_inst, fsm_inst->state.cur, fsm_inst->state.next, tick );
+        #endif
+
+        // Notify observer
+        if ( NULL != fsm_inst->observer )
+        {
+            fsm_inst->observer( fsm_inst->id, fsm_inst->state.cur, fsm_inst->state.next, tick );
+        }
+
+        #if ( FSM_CFG_MAX_SUBSCRIPTIONS > 0 )
+            fsm_signal_publish( fsm_inst, fsm_inst->state.next );
+        #endif
+
+        #if ( FSM_CFG_HSM_EN )
+
+            // Exit and enter state chains around least common ancestor
+            fsm_hsm_transition(fsm_inst, tick);
+
+        #else
+
+            // Execute on exit state handle
+            fsm_exit_cur_state(fsm_inst);
+
+            // Change state and execute on entry handle
+            fsm_enter_next_state(fsm_inst, tick);
+
+        #endif
+
+        // First entry to state
+        fsm_inst->first_entry = true;
+
+        // New state starts its activity sequence from the top
+        fsm_inst->lc = 0U;
+    }
+
+    // Same state
+    else
+    {
+        fsm_inst->first_entry = false;
+    }
+
+    fsm_handle_cur_state(fsm_inst, tick);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset FSM states, and timing, back to initial (default) values
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void fsm_reset_state(const p_fsm_t fsm_inst)
+{
+    fsm_inst->state.cur     = 0U;
+    fsm_inst->state.next    = fsm_inst->state.cur;
+    fsm_inst->state.is_init = true;
+    fsm_inst->duration      = 0U;
+    fsm_inst->tick_prev     = 0U;
+    fsm_inst->period_ref    = 0U;
+    fsm_inst->inputs        = 0U;
+    fsm_inst->lc            = 0U;
+    fsm_inst->hndl_state    = 0U;
+    fsm_inst->is_init       = true;
+    fsm_inst->first_entry   = false;
+    fsm_inst->time_driven   = false;
+    fsm_inst->evq.head      = 0U;
+    fsm_inst->evq.tail      = 0U;
+    fsm_inst->overrun_cnt   = 0U;
+    fsm_inst->overrun_reported = false;
+
+#if ( FSM_CFG_HISTORY_SIZE > 0 )
+    fsm_inst->hist_idx = 0U;
+    fsm_inst->hist_cnt = 0U;
+#endif
+
+#if ( FSM_CFG_STATS_EN )
+    for ( uint8_t state = 0U; state < FSM_CFG_MAX_STATES; state++ )
+    {
+        fsm_inst->stats[state].min      = 0xFFFFFFFFUL;
+        fsm_inst->stats[state].max      = 0U;
+        fsm_inst->stats[state].total    = 0U;
+        fsm_inst->stats[state].cnt      = 0U;
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup FSM_API
+* @{ <!-- BEGIN GROUP -->
+*
+*     Following functions are part of API calls.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialise FSMs
+*
+* @param[out]   p_fsm_inst  - Pointer to FSM instance
+* @param[in]    p_cfg       - Pointer to FSM configuration table
+* @return       status      - Status of initialisation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_init(p_fsm_t * p_fsm_inst, const fsm_cfg_t * const p_cfg)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != p_fsm_inst );
+    FSM_ASSERT( NULL != p_cfg );
+
+    if     (    ( NULL != p_fsm_inst )
+        &&    ( NULL != p_cfg ))
+    {
+        // Allocate space
+        *p_fsm_inst = fsm_alloc();
+
+        FSM_ASSERT( NULL != *p_fsm_inst );
+
+        // Check if allocation succeed
+        if ( NULL != *p_fsm_inst )
+        {
+        #if ( FSM_CFG_MAX_INSTANCES > 0 )
+            status = fsm_init_instance( *p_fsm_inst, p_cfg, eFSM_MEM_POOL );
+        #else
+            status = fsm_init_instance( *p_fsm_inst, p_cfg, eFSM_MEM_HEAP );
         #endif
 
-        // Execute on exit state handle
-        fsm_exit_cur_state(fsm_inst);
+            // Return half-initialized instance to its allocator on invalid
+            // configuration - caller must never be handed instance that
+            // "fsm_deinit" would mis-free
+            if ( eFSM_OK != status )
+            {
+            #if ( FSM_CFG_MAX_INSTANCES > 0 )
+
+                // Push to head of pool freelist
+                (*p_fsm_inst)->p_next_free = gp_fsm_pool_free;
+                gp_fsm_pool_free = *p_fsm_inst;
+            #else
+                free( *p_fsm_inst );
+            #endif
+
+                *p_fsm_inst = NULL;
+            }
+        }
+        else
+        {
+            status = eFSM_ERROR_INIT;
+        }
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Initialise FSM with caller-provided instance storage
+*
+*       Memory provided by caller must be at least "fsm_get_instance_size()"
+*       bytes big and aligned as native pointer. It is up to the application
+*       where that storage lives (e.g. DTCM/CCM RAM for single-cycle access).
+*
+* @param[out]   p_fsm_inst  - Pointer to FSM instance
+* @param[in]    p_cfg       - Pointer to FSM configuration table
+* @param[in]    p_mem       - Caller-provided storage for instance
+* @return       status      - Status of initialisation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_init_static(p_fsm_t * p_fsm_inst, const fsm_cfg_t * const p_cfg, void * const p_mem)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != p_fsm_inst );
+    FSM_ASSERT( NULL != p_cfg );
+    FSM_ASSERT( NULL != p_mem );
+
+    if  (   ( NULL != p_fsm_inst )
+        &&  ( NULL != p_cfg )
+        &&  ( NULL != p_mem ))
+    {
+        *p_fsm_inst = (fsm_t*) p_mem;
+
+        status = fsm_init_instance( *p_fsm_inst, p_cfg, eFSM_MEM_STATIC );
+
+        // Caller owns memory - only make sure half-initialized instance is
+        // not handed out
+        if ( eFSM_OK != status )
+        {
+            *p_fsm_inst = NULL;
+        }
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Get size of single FSM instance in bytes
+*
+*       Helper for sizing caller-provided storage passed to "fsm_init_static".
+*
+* @return       size - Size of FSM instance in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fsm_get_instance_size(void)
+{
+    return (uint32_t) sizeof( fsm_t );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Get size of active FSM state table in bytes
+*
+*       Helper for sizing caller-provided shadow storage passed to
+*       "fsm_cache_cfg".
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       size        - Size of active state table in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fsm_get_cfg_size(const p_fsm_t fsm_inst)
+{
+    uint32_t size = 0U;
+
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( NULL != fsm_inst )
+    {
+        size = (uint32_t) ( fsm_inst->p_cfg->num_of * sizeof( fsm_state_cfg_t ));
+    }
+
+    return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Cache FSM state table into caller-provided RAM shadow
+*
+*       Copies active state table into "p_mem" and serves all further state
+*       dispatch from there - removes flash wait state stalls that every
+*       "p_states" access in handler costs on flash-resident tables. Memory
+*       provided by caller must be at least "fsm_get_cfg_size()" bytes big
+*       and aligned as native pointer. It is up to the application where that
+*       storage lives (e.g. zero-wait-state DTCM/CCM RAM).
+*
+*       Selectable per instance - intended for hottest machines only. Use
+*       "fsm_get_mem_rpt" to budget which instances earn RAM residency.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    p_mem       - Caller-provided storage for state table shadow
+* @param[in]    size        - Size of provided storage in bytes
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_cache_cfg(const p_fsm_t fsm_inst, void * const p_mem, const uint32_t size)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( NULL != p_mem );
+    FSM_ASSERT( size >= fsm_get_cfg_size( fsm_inst ));
+
+    if  (   ( NULL != fsm_inst )
+        &&  ( NULL != p_mem )
+        &&  ( size >= fsm_get_cfg_size( fsm_inst )))
+    {
+        // Copy from active table so resolved no-op handlers are kept
+        memcpy( p_mem, fsm_inst->p_states, fsm_get_cfg_size( fsm_inst ));
+
+        fsm_inst->p_states = (const fsm_state_cfg_t*) p_mem;
+        fsm_inst->cfg_cached = true;
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Get FSM initialisation flag
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[out]    p_is_init  - Initialisation flag
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_is_init(const p_fsm_t fsm_inst, bool * const p_is_init)
+{
+    fsm_status_t status = eFSM_OK;
+
+    if ( NULL != fsm_inst )
+    {
+        *p_is_init = fsm_inst->is_init;
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Reset FSM back to its initial state without triggering any state behaviors
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_reset(const p_fsm_t fsm_inst)
+{
+    fsm_status_t status = eFSM_OK;
+
+    if ( NULL != fsm_inst )
+    {
+        fsm_reset_state( fsm_inst );
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       De-initialization of FSM instance
+*
+*       Counterpart to "fsm_init"/"fsm_init_static": instance is returned to
+*       its allocator in O(1) - pool instances are pushed back onto freelist
+*       (zero fragmentation at create/destroy churn), heap instances are
+*       freed and caller-provided storage is simply released from module
+*       bookkeeping. Registrations and signal bus subscriptions of instance
+*       are dropped. Instance pointer is NULL-ed to prevent use after
+*       de-init.
+*
+* @param[in]    p_fsm_inst  - Pointer to FSM instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_deinit(p_fsm_t * p_fsm_inst)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != p_fsm_inst );
+    FSM_ASSERT( NULL != *p_fsm_inst );
+
+    if  (   ( NULL != p_fsm_inst )
+        &&  ( NULL != *p_fsm_inst ))
+    {
+        const p_fsm_t fsm_inst = *p_fsm_inst;
+
+        // Drop registry entry - keep registration order of remaining instances
+        for ( uint32_t idx = 0U; idx < g_fsm_registry_cnt; idx++ )
+        {
+            if ( fsm_inst == g_fsm_registry[idx] )
+            {
+                for ( uint32_t mov = idx; mov < ( g_fsm_registry_cnt - 1U ); mov++ )
+                {
+                    g_fsm_registry[mov] = g_fsm_registry[mov+1U];
+                    g_fsm_registry_worker[mov] = g_fsm_registry_worker[mov+1U];
+                }
+
+                g_fsm_registry_cnt--;
+                break;
+            }
+        }
+
+#if ( FSM_CFG_MAX_SUBSCRIPTIONS > 0 )
+
+        // Drop subscriptions where instance publishes or subscribes
+        for ( uint8_t idx = 0U; idx < g_fsm_sub_cnt; )
+        {
+            if  (   ( fsm_inst == g_fsm_subs[idx].publisher )
+                ||  ( fsm_inst == g_fsm_subs[idx].subscriber ))
+            {
+                g_fsm_subs[idx] = g_fsm_subs[g_fsm_sub_cnt-1U];
+                g_fsm_sub_cnt--;
+            }
+            else
+            {
+                idx++;
+            }
+        }
+
+#endif
+
+        // Block further handling of released instance
+        fsm_inst->is_init = false;
+
+        // Return instance to its allocator
+        switch ( fsm_inst->mem )
+        {
+            case eFSM_MEM_HEAP:
+                free( fsm_inst );
+                break;
+
+#if ( FSM_CFG_MAX_INSTANCES > 0 )
+            case eFSM_MEM_POOL:
+
+                // Push to head of pool freelist
+                fsm_inst->p_next_free = gp_fsm_pool_free;
+                gp_fsm_pool_free = fsm_inst;
+                break;
+#endif
+
+            case eFSM_MEM_STATIC:
+
+                // Caller owns memory - nothing to release
+                break;
+
+            default:
+                status = eFSM_ERROR;
+                break;
+        }
+
+        *p_fsm_inst = NULL;
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Save FSM state snapshot to binary blob
+*
+*       Serializes current/next state, duration and shared data into
+*       fixed-layout, versioned blob of "FSM_SNAPSHOT_SIZE" bytes - suitable
+*       for retained RAM or EEPROM to support warm boot.
+*
+* @note     Shared data is serialized through its 32-bit view ("u32") -
+*           pointer member is not preserved across save/restore!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[out]   p_buf       - Buffer for snapshot blob
+* @param[in]    size        - Size of buffer in bytes
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_save(const p_fsm_t fsm_inst, uint8_t * const p_buf, const uint32_t size)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( NULL != p_buf );
+    FSM_ASSERT( size >= FSM_SNAPSHOT_SIZE );
+
+    if  (   ( NULL != fsm_inst )
+        &&  ( NULL != p_buf )
+        &&  ( size >= FSM_SNAPSHOT_SIZE ))
+    {
+        fsm_snapshot_t snap = {0};
+
+        snap.magic      = FSM_SNAPSHOT_MAGIC;
+        snap.version    = FSM_SNAPSHOT_VER;
+        snap.cur        = fsm_inst->state.cur;
+        snap.next       = fsm_inst->state.next;
+        snap.res        = 0U;
+        snap.duration   = fsm_inst->duration;
+        snap.tick_prev  = fsm_inst->tick_prev;
+        snap.data_u32   = fsm_inst->data.u32;
+
+        memcpy( p_buf, &snap, FSM_SNAPSHOT_SIZE );
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*   Restore FSM state from snapshot blob
+*
+*       Resumes FSM in saved state with saved duration and shared data,
+*       without re-executing entry handlers. Duration accounting is
+*       re-anchored to current system tick. Instance must be initialized
+*       before restore!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    p_buf       - Buffer with snapshot blob
+* @param[in]    size        - Size of buffer in bytes
+* @return       status      - Status of operation, error on invalid blob
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_restore(const p_fsm_t fsm_inst, const uint8_t * const p_buf, const uint32_t size)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( NULL != p_buf );
+    FSM_ASSERT( size >= FSM_SNAPSHOT_SIZE );
+
+    if  (   ( NULL != fsm_inst )
+        &&  ( NULL != p_buf )
+        &&  ( size >= FSM_SNAPSHOT_SIZE ))
+    {
+        fsm_snapshot_t snap = {0};
+        memcpy( &snap, p_buf, FSM_SNAPSHOT_SIZE );
+
+        // Validate blob before touching instance
+        if  (   ( FSM_SNAPSHOT_MAGIC == snap.magic )
+            &&  ( FSM_SNAPSHOT_VER == snap.version )
+            &&  ( snap.cur < fsm_inst->p_cfg->num_of )
+            &&  ( snap.next < fsm_inst->p_cfg->num_of ))
+        {
+            fsm_inst->state.cur     = snap.cur;
+            fsm_inst->state.next    = snap.next;
+            fsm_inst->state.is_init = false;
+            fsm_inst->duration      = snap.duration;
+            fsm_inst->data.p        = NULL;
+            fsm_inst->data.u32      = snap.data_u32;
+            fsm_inst->first_entry   = false;
+
+            // Clear per-visit bookkeeping same as state change does - stale
+            // continuation/period/overrun of pre-restore run must not leak
+            // into restored state
+            fsm_inst->lc                = 0U;
+            fsm_inst->period_ref        = 0U;
+            fsm_inst->overrun_reported  = false;
+
+            // Re-anchor duration accounting to current time
+            fsm_inst->tick_prev = FSM_GET_SYSTICK();
+
+            fsm_update_time_driven( fsm_inst );
+        }
+        else
+        {
+            status = eFSM_ERROR;
+        }
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       FSM handler
+*
+* @note     Each instance of FSM must call its own handler!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_hndl(const p_fsm_t fsm_inst)
+{
+    return fsm_hndl_tick( fsm_inst, FSM_GET_SYSTICK());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       FSM handler with externally sampled system tick
+*
+*       Same as "fsm_hndl" only that system tick is provided by caller. Use
+*       when servicing many instances per scheduling pass to sample the clock
+*       once instead of once per instance.
+*
+* @note     Each instance of FSM must call its own handler!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    tick        - Current system tick in ms
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_hndl_tick(const p_fsm_t fsm_inst, const uint32_t tick)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( FSM_API_CHECK( NULL != fsm_inst ))
+    {
+        if ( FSM_API_CHECK( true == fsm_inst->is_init ))
+        {
+            // Event driven machine with nothing pending -> nothing to service.
+            // States with timeout/period/overrun configured are never skipped -
+            // their time driven logic lives in manager and must keep running!
+            if  (   ( true == fsm_inst->p_cfg->event_driven )
+                &&  ( false == fsm_inst->state.is_init )
+                &&  ( false == fsm_inst->time_driven )
+                &&  ( true == fsm_evq_is_empty( fsm_inst ))
+                &&  ( fsm_inst->state.cur == fsm_inst->state.next ))
+            {
+                // No actions...
+            }
+            else
+            {
+                fsm_manager( fsm_inst, tick );
+            }
+        }
+        else
+        {
+            status = eFSM_ERROR_INIT;
+            FSM_ASSERT(0); // USAGE ERROR: Handling FSM before init!
+        }
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Advance FSM by given amount of simulated time
+*
+*       Fast-forward alternative to calling handler once per millisecond -
+*       intended for host-based simulation/testing where 24h scenarios shall
+*       run in seconds. Time is stepped from instance's last serviced tick in
+*       largest steps that do not skip over a timeout, periodic activity or
+*       deadline overrun point, so time driven logic fires the correct number
+*       of times. States without time driven configuration execute activity
+*       once per call, not once per simulated millisecond!
+*
+* @note     Do not mix with "fsm_hndl" on same instance - simulated time and
+*           "FSM_GET_SYSTICK" time base will not agree!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    elapsed_ms  - Amount of time to advance in ms
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_advance(const p_fsm_t fsm_inst, const uint32_t elapsed_ms)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( NULL != fsm_inst )
+    {
+        if ( true == fsm_inst->is_init )
+        {
+            uint32_t remain = elapsed_ms;
+
+            // Resolve work already pending at current simulated time
+            // (initial entry, queued events, requested transition)
+            fsm_manager( fsm_inst, fsm_inst->tick_prev );
+
+            while ( remain > 0U )
+            {
+                // Transition or event still pending -> service again at same
+                // simulated time before letting time pass
+                if  (   ( fsm_inst->state.cur != fsm_inst->state.next )
+                    ||  ( false == fsm_evq_is_empty( fsm_inst )))
+                {
+                    fsm_manager( fsm_inst, fsm_inst->tick_prev );
+                    continue;
+                }
+
+                const fsm_state_cfg_t * p_state = &fsm_inst->p_states[fsm_inst->state.cur];
+                uint32_t step = remain;
+
+                // Clamp step to state timeout deadline
+                if  (   ( p_state->timeout_ms > 0U )
+                    &&  ( fsm_inst->duration < p_state->timeout_ms ))
+                {
+                    const uint32_t to_timeout = ( p_state->timeout_ms - fsm_inst->duration );
+
+                    if ( to_timeout < step )
+                    {
+                        step = to_timeout;
+                    }
+                }
+
+                // Clamp step to periodic activity deadline
+                if ( p_state->period_ms > 0U )
+                {
+                    const uint32_t elapsed = ( fsm_inst->duration - fsm_inst->period_ref );
+
+                    if ( elapsed < p_state->period_ms )
+                    {
+                        const uint32_t to_period = ( p_state->period_ms - elapsed );
+
+                        if ( to_period < step )
+                        {
+                            step = to_period;
+                        }
+                    }
+                }
+
+                // Clamp step to deadline overrun point
+                if  (   ( p_state->max_duration_ms > 0U )
+                    &&  ( false == fsm_inst->overrun_reported )
+                    &&  ( fsm_inst->duration <= p_state->max_duration_ms ))
+                {
+                    const uint32_t to_overrun = (( p_state->max_duration_ms - fsm_inst->duration ) + 1U );
+
+                    if ( to_overrun < step )
+                    {
+                        step = to_overrun;
+                    }
+                }
+
+                remain -= step;
+                fsm_manager( fsm_inst, ( fsm_inst->tick_prev + step ));
+            }
+        }
+        else
+        {
+            status = eFSM_ERROR_INIT;
+            FSM_ASSERT(0); // USAGE ERROR: Handling FSM before init!
+        }
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Register FSM instance for group handling
+*
+*       Registered instances are all serviced by single "fsm_hndl_all" call.
+*
+* @note     For best cache locality combine with static pool mode
+*           (FSM_CFG_MAX_INSTANCES > 0) where all instances live in one
+*           contiguous block!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_register(const p_fsm_t fsm_inst)
+{
+    // Round-robin instances across worker partitions
+    return fsm_register_worker( fsm_inst, (uint8_t) ( g_fsm_registry_cnt % FSM_CFG_NUM_WORKERS ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Register FSM instance for group handling on given worker partition
+*
+*       Same as "fsm_register" only that worker partition is picked by caller
+*       instead of round-robin - use to balance uneven machines or to pin
+*       coupled machines to same core.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    worker      - Worker partition (0..FSM_CFG_NUM_WORKERS-1)
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_register_worker(const p_fsm_t fsm_inst, const uint8_t worker)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( worker < FSM_CFG_NUM_WORKERS );
+    FSM_ASSERT( g_fsm_registry_cnt < FSM_CFG_MAX_REGISTERED );
+
+    if  (   ( NULL != fsm_inst )
+        &&  ( worker < FSM_CFG_NUM_WORKERS )
+        &&  ( g_fsm_registry_cnt < FSM_CFG_MAX_REGISTERED ))
+    {
+        g_fsm_registry[g_fsm_registry_cnt] = fsm_inst;
+        g_fsm_registry_worker[g_fsm_registry_cnt] = worker;
+        g_fsm_registry_cnt++;
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle all registered FSM instances
+*
+*       Services all registered machines in registration order within single
+*       pass, so per-instance state is walked over adjacent memory instead of
+*       chasing individual instance pointers from application code.
+*
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_hndl_all(void)
+{
+    return fsm_hndl_all_tick( FSM_GET_SYSTICK());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle all registered FSM instances with externally sampled system tick
+*
+*       Same as "fsm_hndl_all" only that system tick is provided by caller and
+*       reused across all registered instances.
+*
+* @param[in]    tick        - Current system tick in ms
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_hndl_all_tick(const uint32_t tick)
+{
+    fsm_status_t status = eFSM_OK;
+
+    for ( uint32_t idx = 0U; idx < g_fsm_registry_cnt; idx++ )
+    {
+        // Collapse any failure - OR-ing mixed enum values is not a member
+        if ( eFSM_OK != fsm_hndl_tick( g_fsm_registry[idx], tick ))
+        {
+            status = eFSM_ERROR;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle registered FSM instances of given worker partition
+*
+*       Intended for multi-core/multi-task servicing: spawn one thread/task
+*       per worker partition, each calling its own "fsm_hndl_worker" every
+*       tick. Instances stay pinned to their partition, so instance data and
+*       config remain hot in one core's cache and per-instance handlers never
+*       run concurrently with themselves - user contract is unchanged.
+*
+* @note     Per-tick synchronization (barrier) between workers is owned by
+*           application - module has no RTOS dependency! Do not mix with
+*           "fsm_hndl_all" while workers are running.
+*
+* @note     Globally shared paths are not multi-producer safe: transition
+*           trace (FSM_CFG_TRACE_EN) is rejected at compile time with more
+*           than one worker, and signal bus subscriptions shall stay within
+*           one partition - a cross-partition publisher would be second
+*           producer on subscriber SPSC queue (see "fsm_subscribe")!
+*
+* @note     Event/state posting to instance of another partition (other
+*           core) is supported, but requires "FSM_MEMORY_BARRIER" mapped to
+*           hardware memory barrier in fsm_cfg.h - default compiler barrier
+*           does not order stores across weakly-ordered SMP cores!
+*
+* @param[in]    worker      - Worker partition (0..FSM_CFG_NUM_WORKERS-1)
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_hndl_worker(const uint8_t worker)
+{
+    return fsm_hndl_worker_tick( worker, FSM_GET_SYSTICK());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Handle registered FSM instances of given worker partition with
+*       externally sampled system tick
+*
+*       Same as "fsm_hndl_worker" only that system tick is provided by caller
+*       and reused across all instances of partition.
+*
+* @param[in]    worker      - Worker partition (0..FSM_CFG_NUM_WORKERS-1)
+* @param[in]    tick        - Current system tick in ms
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_hndl_worker_tick(const uint8_t worker, const uint32_t tick)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( worker < FSM_CFG_NUM_WORKERS );
+
+    if ( worker < FSM_CFG_NUM_WORKERS )
+    {
+        for ( uint32_t idx = 0U; idx < g_fsm_registry_cnt; idx++ )
+        {
+            if ( worker == g_fsm_registry_worker[idx] )
+            {
+                if ( eFSM_OK != fsm_hndl_tick( g_fsm_registry[idx], tick ))
+                {
+                    status = eFSM_ERROR;
+                }
+            }
+        }
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set next FSM state
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    state       - Next state
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_goto_state(const p_fsm_t fsm_inst, const uint8_t state)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( state < fsm_inst->p_cfg->num_of );
+
+    if  ( FSM_API_CHECK(    ( NULL != fsm_inst )
+                        &&  ( state < fsm_inst->p_cfg->num_of )))
+    {
+        fsm_inst->state.next = state;
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set next FSM state with entry argument
+*
+*       Argument is latched with state request into instance queue and written
+*       into shared data ("fsm_get_data") right before entry of requested
+*       state executes - single call replaces "fsm_set_data" + "fsm_goto_state"
+*       pair. Each queued request keeps its own argument, so requests racing
+*       before next handler call do not clobber each other.
+*
+* @note     Posting from different core than one servicing the instance
+*           requires "FSM_MEMORY_BARRIER" mapped to hardware memory barrier!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    state       - Next state
+* @param[in]    arg         - Entry argument - delivered as shared data
+* @return       status      - Status of operation, error when queue is full
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_goto_state_with_arg(const p_fsm_t fsm_inst, const uint8_t state, const fsm_data_t arg)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( state < fsm_inst->p_cfg->num_of );
+
+    if  ( FSM_API_CHECK(    ( NULL != fsm_inst )
+                        &&  ( state < fsm_inst->p_cfg->num_of )))
+    {
+        status = fsm_evq_push( fsm_inst, eFSM_EVQ_STATE_ARG, state, arg );
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
 
-        // Change state and execute on entry handle
-        fsm_enter_next_state(fsm_inst);
+    return status;
+}
 
-        // First entry to state
-        fsm_inst->first_entry = true;
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Post event to FSM
+*
+*       Event is resolved into state transition on next handler call via
+*       current state event lookup table ("p_events" in state configuration).
+*       Events that current state does not react to are discarded.
+*
+* @note     Posting from different core than one servicing the instance
+*           requires "FSM_MEMORY_BARRIER" mapped to hardware memory barrier!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    event       - Event ID
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_post_event(const p_fsm_t fsm_inst, const uint8_t event)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( event < fsm_inst->p_cfg->num_of_events );
+
+    if  ( FSM_API_CHECK(    ( NULL != fsm_inst )
+                        &&  ( event < fsm_inst->p_cfg->num_of_events )))
+    {
+        status = fsm_evq_push( fsm_inst, eFSM_EVQ_EVENT, event, (fsm_data_t) { .u32 = 0U } );
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Request FSM state change from interrupt context
+*
+*       Wait-free alternative to "fsm_goto_state" - request is pushed to
+*       instance SPSC queue and applied on next handler call, so no critical
+*       section is needed around calls from single ISR.
+*
+* @note     Posting from different core than one servicing the instance
+*           requires "FSM_MEMORY_BARRIER" mapped to hardware memory barrier!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    state       - Requested state
+* @return       status      - Status of operation, error when queue is full
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_request_state(const p_fsm_t fsm_inst, const uint8_t state)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( state < fsm_inst->p_cfg->num_of );
+
+    if  ( FSM_API_CHECK(    ( NULL != fsm_inst )
+                        &&  ( state < fsm_inst->p_cfg->num_of )))
+    {
+        status = fsm_evq_push( fsm_inst, eFSM_EVQ_STATE, state, (fsm_data_t) { .u32 = 0U } );
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Subscribe to state transitions of another FSM instance
+*
+*       Every transition of publisher is pushed into subscriber event queue
+*       as event "event_base" + entered state, resolved via subscriber event
+*       lookup tables on its next handler call - replaces cross-machine state
+*       polling with couple of stores per transition. Published states that
+*       fall outside subscriber event space are discarded.
+*
+* @note     Publishing happens in publisher handler context - service
+*           publisher and all external producers of subscriber queue from
+*           same context (queue is single-producer)! With multiple worker
+*           partitions (FSM_CFG_NUM_WORKERS > 1) this means publisher and
+*           subscriber shall be registered on same partition - a
+*           cross-partition publisher would push concurrently with
+*           subscriber's own partition and corrupt the queue.
+*
+* @param[in]    publisher   - Instance whose transitions are published
+* @param[in]    subscriber  - Instance receiving transitions as events
+* @param[in]    event_base  - Event ID offset in subscriber event space
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_subscribe(const p_fsm_t publisher, const p_fsm_t subscriber, const uint8_t event_base)
+{
+    fsm_status_t status = eFSM_OK;
+
+#if ( FSM_CFG_MAX_SUBSCRIPTIONS > 0 )
+
+    FSM_ASSERT( NULL != publisher );
+    FSM_ASSERT( NULL != subscriber );
+    FSM_ASSERT( publisher != subscriber );
+    FSM_ASSERT( g_fsm_sub_cnt < FSM_CFG_MAX_SUBSCRIPTIONS );
+
+    if  (   ( NULL != publisher )
+        &&  ( NULL != subscriber )
+        &&  ( publisher != subscriber )
+        &&  ( g_fsm_sub_cnt < FSM_CFG_MAX_SUBSCRIPTIONS ))
+    {
+        g_fsm_subs[g_fsm_sub_cnt].publisher     = publisher;
+        g_fsm_subs[g_fsm_sub_cnt].subscriber    = subscriber;
+        g_fsm_subs[g_fsm_sub_cnt].event_base    = event_base;
+        g_fsm_sub_cnt++;
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+#else
+    (void) publisher;
+    (void) subscriber;
+    (void) event_base;
+    status = eFSM_ERROR;
+#endif
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set FSM input word
+*
+*       Single 32-bit word carrying boolean inputs (faults, limits, enables)
+*       evaluated against guard condition tables ("p_guards" in state
+*       configuration). Guards of current state are evaluated right away so
+*       event driven machines react without waiting for periodic servicing,
+*       and again on every handler pass.
+*
+* @note     Call from same context as instance handler!
+*
+* @param[in]    fsm_inst    - FSM instance
+* @param[in]    inputs      - Input word
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_status_t fsm_set_inputs(const p_fsm_t fsm_inst, const uint32_t inputs)
+{
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( NULL != fsm_inst )
+    {
+        fsm_inst->inputs = inputs;
+
+        // Resolve guards at once - transition is picked up on next handler pass
+        if ( false == fsm_inst->state.is_init )
+        {
+            fsm_process_guards( fsm_inst );
+        }
+    }
+    else
+    {
+        status = eFSM_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get FSM input word
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       inputs      - Input word
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fsm_get_inputs(const p_fsm_t fsm_inst)
+{
+    uint32_t inputs = 0U;
+
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( NULL != fsm_inst )
+    {
+        inputs = fsm_inst->inputs;
+    }
+
+    return inputs;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get current FSM state
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       state       - Current state of FSM
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint8_t fsm_get_state(const p_fsm_t fsm_inst)
+{
+    uint8_t state = 0U;
+
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( NULL != fsm_inst )
+    {
+        state = fsm_inst->state.cur;
+    }
+
+    return state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get FSM state time duration in miliseconds
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       duration    - Duration inside state in ms
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fsm_get_duration(const p_fsm_t fsm_inst)
+{
+    uint32_t duration = 0;
+
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( NULL != fsm_inst )
+    {
+        duration = fsm_inst->duration;
+    }
+
+    return duration;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get system tick at which FSM needs servicing next
+*
+*       Intended for tickless low-power scheduling: scheduler can sleep until
+*       returned tick instead of polling idle machines. Machines with pending
+*       work (queued event/state request or pending transition) report their
+*       last serviced tick, i.e. they shall be serviced immediately.
+*
+* @note     Returned tick is based on last handler call - keep servicing
+*           machine at returned tick to keep accounting accurate!
+*
+* @note     Every reported wake tick is acted on by handler: event driven
+*           machines are not skipped while current state has time driven
+*           configuration (timeout/period/overrun), so sleeping until
+*           returned tick always makes progress.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       wake        - Tick of next needed servicing in ms, or
+*                             FSM_WAKE_NONE when no time driven work pends
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fsm_get_next_wake(const p_fsm_t fsm_inst)
+{
+    uint32_t wake = FSM_WAKE_NONE;
+
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( NULL != fsm_inst )
+    {
+        // Pending work -> service immediately
+        if  (   ( true == fsm_inst->state.is_init )
+            ||  ( false == fsm_evq_is_empty( fsm_inst ))
+            ||  ( fsm_inst->state.cur != fsm_inst->state.next ))
+        {
+            wake = fsm_inst->tick_prev;
+        }
+        else
+        {
+            const fsm_state_cfg_t * p_state = &fsm_inst->p_states[fsm_inst->state.cur];
+
+            // State timeout deadline
+            if ( p_state->timeout_ms > 0U )
+            {
+                const uint32_t remain = ( fsm_inst->duration >= p_state->timeout_ms ) ? ( 0U ) : ( p_state->timeout_ms - fsm_inst->duration );
+                wake = fsm_inst->tick_prev + remain;
+            }
+
+            // Periodic activity deadline
+            if ( p_state->period_ms > 0U )
+            {
+                const uint32_t elapsed = ( fsm_inst->duration - fsm_inst->period_ref );
+                const uint32_t remain = ( elapsed >= p_state->period_ms ) ? ( 0U ) : ( p_state->period_ms - elapsed );
+                const uint32_t period_wake = fsm_inst->tick_prev + remain;
+
+                if ( period_wake < wake )
+                {
+                    wake = period_wake;
+                }
+            }
+
+            // Activity runs on every call -> needs servicing right away,
+            // unless machine is purely event driven
+            else if ( false == fsm_inst->p_cfg->event_driven )
+            {
+                wake = fsm_inst->tick_prev;
+            }
+        }
+    }
+
+    return wake;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get system tick at which any registered FSM needs servicing next
+*
+*       Group-wide minimum of "fsm_get_next_wake" across all registered
+*       instances.
+*
+* @return       wake        - Tick of next needed servicing in ms, or
+*                             FSM_WAKE_NONE when no time driven work pends
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fsm_get_next_wake_all(void)
+{
+    uint32_t wake = FSM_WAKE_NONE;
+
+    for ( uint32_t idx = 0U; idx < g_fsm_registry_cnt; idx++ )
+    {
+        const uint32_t inst_wake = fsm_get_next_wake( g_fsm_registry[idx] );
+
+        if ( inst_wake < wake )
+        {
+            wake = inst_wake;
+        }
+    }
+
+    return wake;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset FSM state time duration
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void fsm_reset_duration(const p_fsm_t fsm_inst)
+{
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( NULL != fsm_inst )
+    {
+        fsm_inst->duration = 0;
+        fsm_inst->tick_prev = FSM_GET_SYSTICK();
     }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get FSM shared data
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       data        - Data
+*/
+////////////////////////////////////////////////////////////////////////////////
+fsm_data_t fsm_get_data(const p_fsm_t fsm_inst)
+{
+    fsm_data_t data = {0};
+
+    FSM_ASSERT( NULL != fsm_inst );
 
-    // Same state
-    else
+    if ( NULL != fsm_inst )
     {
-        fsm_inst->first_entry = false;
+        data = fsm_inst->data;
     }
 
-    fsm_handle_cur_state(fsm_inst);
+    return data;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Reset FSM states, and timing, back to initial (default) values
+*       Set FSM shared data
 *
 * @param[in]    fsm_inst    - FSM instance
+* @param[in]    data        - Data
 * @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void fsm_reset_state(const p_fsm_t fsm_inst)
+void fsm_set_data(const p_fsm_t fsm_inst, const fsm_data_t data)
 {
-    fsm_inst->state.cur     = 0U;
-    fsm_inst->state.next    = fsm_inst->state.cur;
-    fsm_inst->state.is_init = true;
-    fsm_inst->duration      = 0U;
-    fsm_inst->tick_prev     = 0U;
-    fsm_inst->is_init       = true;
-    fsm_inst->first_entry   = false;
+    if ( NULL != fsm_inst )
+    {
+        fsm_inst->data = data;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-* @} <!-- END GROUP -->
+*       Get direct pointer to FSM shared data
+*
+*       Zero-copy alternative to "fsm_get_data"/"fsm_set_data" - handlers can
+*       mutate shared state in place. With inline user context block enabled
+*       (FSM_CFG_DATA_SIZE > 0) returned pointer addresses that block,
+*       otherwise it addresses built-in 4-byte shared data.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       p_data      - Pointer to shared data
 */
 ////////////////////////////////////////////////////////////////////////////////
+void * fsm_get_data_ptr(const p_fsm_t fsm_inst)
+{
+    void * p_data = NULL;
+
+    FSM_ASSERT( NULL != fsm_inst );
+
+    if ( NULL != fsm_inst )
+    {
+    #if ( FSM_CFG_DATA_SIZE > 0 )
+        p_data = (void*) &fsm_inst->data_blk[0];
+    #else
+        p_data = (void*) &fsm_inst->data;
+    #endif
+    }
+
+    return p_data;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*@addtogroup FSM_API
-* @{ <!-- BEGIN GROUP -->
+*       Get first state entry flag
 *
-*     Following functions are part of API calls.
+* @param[in]    fsm_inst        - FSM instance
+* @return       first_entry     - First entry into state
 */
 ////////////////////////////////////////////////////////////////////////////////
+bool fsm_get_first_entry(const p_fsm_t fsm_inst)
+{
+    bool first_entry = false;
+
+    if ( NULL != fsm_inst )
+    {
+        first_entry = fsm_inst->first_entry;
+    }
+
+    return first_entry;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Initialise FSMs
+*       Get state whose handler is currently executing
 *
-* @param[out]   p_fsm_inst  - Pointer to FSM instance
-* @param[in]    p_cfg       - Pointer to FSM configuration table
-* @return       status      - Status of initialisation
+*       Inside entry/exit handlers this is the state being entered/exited -
+*       unlike "fsm_get_state" which still reports old state during entry.
+*       Intended for shared dispatch handlers (e.g. "fsm_switch.h"
+*       trampolines) that serve multiple states.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       state       - State being handled
 */
 ////////////////////////////////////////////////////////////////////////////////
-fsm_status_t fsm_init(p_fsm_t * p_fsm_inst, const fsm_cfg_t * const p_cfg)
+uint8_t fsm_get_hndl_state(const p_fsm_t fsm_inst)
 {
-    fsm_status_t status = eFSM_OK;
-
-    FSM_ASSERT( NULL != p_fsm_inst );
-    FSM_ASSERT( NULL != p_cfg );
+    uint8_t state = 0U;
 
-    if     (    ( NULL != p_fsm_inst )
-        &&    ( NULL != p_cfg ))
+    if ( NULL != fsm_inst )
     {
-        // Allocate space
-        *p_fsm_inst = malloc( sizeof( fsm_t ));
+        state = fsm_inst->hndl_state;
+    }
 
-        FSM_ASSERT( NULL != *p_fsm_inst );
-        FSM_ASSERT( p_cfg->num_of > 0  );
+    return state;
+}
 
-        // Check if allocation succeed
-        if  (   ( NULL != *p_fsm_inst )
-            &&  ( p_cfg->num_of > 0 ))
-        {
-            // Get setup
-            (*p_fsm_inst)->p_cfg = (fsm_cfg_t*) p_cfg;
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get activity handler continuation slot
+*
+*       Plumbing for "FSM_PT_BEGIN" macro - not meant to be called directly.
+*
+* @param[in]    fsm_inst    - FSM instance
+* @return       lc          - Continuation slot value
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint16_t fsm_pt_get(const p_fsm_t fsm_inst)
+{
+    uint16_t lc = 0U;
 
-            // Init FSM to default
-            fsm_reset_state(*p_fsm_inst);
-        }
-        else
-        {
-            status = eFSM_ERROR_INIT;
-        }
-    }
-    else
+    if ( NULL != fsm_inst )
     {
-        status = eFSM_ERROR;
+        lc = fsm_inst->lc;
     }
 
-    return status;
+    return lc;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Get FSM initialisation flag
+*       Set activity handler continuation slot
+*
+*       Plumbing for "FSM_YIELD"/"FSM_AWAIT"/"FSM_PT_END" macros - not meant
+*       to be called directly. Slot is cleared by module on every state
+*       change.
 *
 * @param[in]    fsm_inst    - FSM instance
-* @param[out]    p_is_init  - Initialisation flag
-* @return       status      - Status of operation
+* @param[in]    lc          - Continuation slot value
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-fsm_status_t fsm_is_init(const p_fsm_t fsm_inst, bool * const p_is_init)
+void fsm_pt_set(const p_fsm_t fsm_inst, const uint16_t lc)
 {
-    fsm_status_t status = eFSM_OK;
-
     if ( NULL != fsm_inst )
     {
-        *p_is_init = fsm_inst->is_init;
-    }
-    else
-    {
-        status = eFSM_ERROR;
+        fsm_inst->lc = lc;
     }
-
-    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*   Reset FSM back to its initial state without triggering any state behaviors
+*       Register state overrun callback
+*
+*       Callback is invoked once per state visit when time in state exceeds
+*       its configured "max_duration_ms". Pass NULL to unregister.
 *
 * @param[in]    fsm_inst    - FSM instance
-* @return       status      - Status of operation
+* @param[in]    callback    - Overrun callback
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-fsm_status_t fsm_reset(const p_fsm_t fsm_inst)
+void fsm_set_overrun_cb(const p_fsm_t fsm_inst, const pf_overrun_t callback)
 {
-    fsm_status_t status = eFSM_OK;
+    FSM_ASSERT( NULL != fsm_inst );
 
     if ( NULL != fsm_inst )
     {
-        fsm_reset_state( fsm_inst );
-    }
-    else
-    {
-        status = eFSM_ERROR;
+        fsm_inst->overrun_cb = callback;
     }
-
-    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       FSM handler
+*       Register transition observer callback
 *
-* @note     Each instance of FSM must call its own handler!
+*       Observer is invoked on every transition with raw integers (instance
+*       ID, from/to state, tick) - any formatting or batching shall happen
+*       inside observer implementation, off the critical path. Pass NULL to
+*       unregister.
 *
 * @param[in]    fsm_inst    - FSM instance
-* @return       status      - Status of operation
+* @param[in]    observer    - Observer callback
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-fsm_status_t fsm_hndl(const p_fsm_t fsm_inst)
+void fsm_set_observer(const p_fsm_t fsm_inst, const pf_observer_t observer)
 {
-    fsm_status_t status = eFSM_OK;
-
     FSM_ASSERT( NULL != fsm_inst );
 
     if ( NULL != fsm_inst )
     {
-        if ( true == fsm_inst->is_init )
-        {
-            fsm_manager( fsm_inst );
-        }
-        else
-        {
-            status = eFSM_ERROR_INIT;
-            FSM_ASSERT(0); // USAGE ERROR: Handling FSM before init!
-        }
-    }
-    else
-    {
-        status = eFSM_ERROR;
+        fsm_inst->observer = observer;
     }
-
-    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Set next FSM state
+*       Get FSM instance ID
+*
+*       ID is assigned in order of init and reported in trace records and
+*       observer callbacks.
 *
 * @param[in]    fsm_inst    - FSM instance
-* @param[in]    state       - Next state
-* @return       status      - Status of operation
+* @return       id          - Instance ID
 */
 ////////////////////////////////////////////////////////////////////////////////
-fsm_status_t fsm_goto_state(const p_fsm_t fsm_inst, const uint8_t state)
+uint8_t fsm_get_id(const p_fsm_t fsm_inst)
 {
-    fsm_status_t status = eFSM_OK;
+    uint8_t id = 0U;
 
     FSM_ASSERT( NULL != fsm_inst );
-    FSM_ASSERT( state < fsm_inst->p_cfg->num_of );
 
-    if  (   ( NULL != fsm_inst )
-        &&  ( state < fsm_inst->p_cfg->num_of ))
-    {
-        fsm_inst->state.next = state;
-    }
-    else
+    if ( NULL != fsm_inst )
     {
-        status = eFSM_ERROR;
+        id = fsm_inst->id;
     }
 
-    return status;
+    return id;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get current FSM state
+*       Get number of state deadline overruns
 *
 * @param[in]    fsm_inst    - FSM instance
-* @return       state       - Current state of FSM
+* @return       overrun_cnt - Number of overruns since init/reset
 */
 ////////////////////////////////////////////////////////////////////////////////
-uint8_t fsm_get_state(const p_fsm_t fsm_inst)
+uint32_t fsm_get_overrun_cnt(const p_fsm_t fsm_inst)
 {
-    uint8_t state = 0U;
+    uint32_t overrun_cnt = 0U;
 
     FSM_ASSERT( NULL != fsm_inst );
 
     if ( NULL != fsm_inst )
     {
-        state = fsm_inst->state.cur;
+        overrun_cnt = fsm_inst->overrun_cnt;
     }
 
-    return state;
+    return overrun_cnt;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get FSM state time duration in miliseconds
+*       Get per-state execution time statistics
+*
+*       Returns min/max/total execution time and execution count accumulated
+*       over entry, activity and exit handlers of given state. Returns error
+*       when statistics are disabled (FSM_CFG_STATS_EN = 0).
 *
 * @param[in]    fsm_inst    - FSM instance
-* @return       duration    - Duration inside state in ms
+* @param[in]    state       - State of interest
+* @param[out]   p_stats     - Statistics of given state
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-uint32_t fsm_get_duration(const p_fsm_t fsm_inst)
+fsm_status_t fsm_get_stats(const p_fsm_t fsm_inst, const uint8_t state, fsm_stats_t * const p_stats)
 {
-    uint32_t duration = 0;
+    fsm_status_t status = eFSM_OK;
+
+#if ( FSM_CFG_STATS_EN )
 
     FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( NULL != p_stats );
+    FSM_ASSERT( state < fsm_inst->p_cfg->num_of );
 
-    if ( NULL != fsm_inst )
+    if  (   ( NULL != fsm_inst )
+        &&  ( NULL != p_stats )
+        &&  ( state < fsm_inst->p_cfg->num_of ))
     {
-        duration = fsm_inst->duration;
+        *p_stats = fsm_inst->stats[state];
+    }
+    else
+    {
+        status = eFSM_ERROR;
     }
 
-    return duration;
+#else
+    (void) fsm_inst;
+    (void) state;
+    (void) p_stats;
+    status = eFSM_ERROR;
+#endif
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Reset FSM state time duration
+*       Get single record from transition history ring
+*
+*       Index 0 is most recent transition, index 1 the one before it and so
+*       on. Records are read in place - nothing is popped or cleared. Returns
+*       error when index exceeds number of stored records or history is
+*       disabled (FSM_CFG_HISTORY_SIZE = 0).
 *
 * @param[in]    fsm_inst    - FSM instance
-* @return       void
+* @param[in]    idx         - Record index - 0 is most recent transition
+* @param[out]   p_rec       - History record
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-void fsm_reset_duration(const p_fsm_t fsm_inst)
+fsm_status_t fsm_get_history(const p_fsm_t fsm_inst, const uint8_t idx, fsm_hist_rec_t * const p_rec)
 {
+    fsm_status_t status = eFSM_OK;
+
+#if ( FSM_CFG_HISTORY_SIZE > 0 )
+
     FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( NULL != p_rec );
 
-    if ( NULL != fsm_inst )
+    if  (   ( NULL != fsm_inst )
+        &&  ( NULL != p_rec )
+        &&  ( idx < fsm_inst->hist_cnt ))
     {
-        fsm_inst->duration = 0;
-        fsm_inst->tick_prev = FSM_GET_SYSTICK();
+        // Walk backwards from write index - most recent record sits one slot behind it
+        const uint8_t slot = (uint8_t) (( fsm_inst->hist_idx - 1U - idx ) & ( FSM_CFG_HISTORY_SIZE - 1U ));
+
+        *p_rec = fsm_inst->hist[slot];
+    }
+    else
+    {
+        status = eFSM_ERROR;
     }
+
+#else
+    (void) fsm_inst;
+    (void) idx;
+    (void) p_rec;
+    status = eFSM_ERROR;
+#endif
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get FSM shared data
+*       Get number of valid transition history records
 *
 * @param[in]    fsm_inst    - FSM instance
-* @return       data        - Data
+* @return       cnt         - Number of stored records - saturates at ring size
 */
 ////////////////////////////////////////////////////////////////////////////////
-fsm_data_t fsm_get_data(const p_fsm_t fsm_inst)
+uint8_t fsm_get_history_cnt(const p_fsm_t fsm_inst)
 {
-    fsm_data_t data = {0};
+    uint8_t cnt = 0U;
+
+#if ( FSM_CFG_HISTORY_SIZE > 0 )
 
     FSM_ASSERT( NULL != fsm_inst );
 
     if ( NULL != fsm_inst )
     {
-        data = fsm_inst->data;
+        cnt = fsm_inst->hist_cnt;
     }
 
-    return data;
+#else
+    (void) fsm_inst;
+#endif
+
+    return cnt;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Set FSM shared data
+*       Get memory footprint report of FSM instance
+*
+*       Reports instance and active state table sizes for budgeting which
+*       machines earn RAM residency of their configuration table
+*       ("fsm_cache_cfg"). Table size covers state table only - configuration
+*       root struct and name strings stay in flash either way.
 *
 * @param[in]    fsm_inst    - FSM instance
-* @param[in]    data        - Data
-* @return       void
+* @param[out]   p_rpt       - Memory footprint report
+* @return       status      - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-void fsm_set_data(const p_fsm_t fsm_inst, const fsm_data_t data)
+fsm_status_t fsm_get_mem_rpt(const p_fsm_t fsm_inst, fsm_mem_rpt_t * const p_rpt)
 {
-    if ( NULL != fsm_inst )
+    fsm_status_t status = eFSM_OK;
+
+    FSM_ASSERT( NULL != fsm_inst );
+    FSM_ASSERT( NULL != p_rpt );
+
+    if  (   ( NULL != fsm_inst )
+        &&  ( NULL != p_rpt ))
     {
-        fsm_inst->data = data;
+        p_rpt->inst_size    = (uint32_t) sizeof( fsm_t );
+        p_rpt->cfg_size     = fsm_get_cfg_size( fsm_inst );
+        p_rpt->num_of       = fsm_inst->p_cfg->num_of;
+        p_rpt->cfg_cached   = fsm_inst->cfg_cached;
+    }
+    else
+    {
+        status = eFSM_ERROR;
     }
+
+    return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get first state entry flag
+*       Get (pop) single record from transition trace ring
 *
-* @param[in]    fsm_inst        - FSM instance
-* @return       first_entry     - First entry into state
+*       Intended to be called from background context (e.g. idle task) to
+*       drain trace records towards UART/RTT or other output.
+*
+* @param[out]   p_rec       - Popped trace record
+* @return       popped      - True when record was popped, false on empty ring
 */
 ////////////////////////////////////////////////////////////////////////////////
-bool fsm_get_first_entry(const p_fsm_t fsm_inst)
+bool fsm_trace_get(fsm_trace_rec_t * const p_rec)
 {
-    bool first_entry = false;
+    bool popped = false;
 
-    if ( NULL != fsm_inst )
+#if ( FSM_CFG_TRACE_EN )
+
+    FSM_ASSERT( NULL != p_rec );
+
+    if ( NULL != p_rec )
     {
-        first_entry = fsm_inst->first_entry;
+        const uint16_t tail = g_fsm_trace_tail;
+
+        if ( tail != g_fsm_trace_head )
+        {
+            *p_rec = g_fsm_trace[tail];
+            g_fsm_trace_tail = (uint16_t) (( tail + 1U ) & ( FSM_CFG_TRACE_BUF_SIZE - 1U ));
+            popped = true;
+        }
     }
 
-    return first_entry;
+#else
+    (void) p_rec;
+#endif
+
+    return popped;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get number of trace records lost due to full trace ring
+*
+* @return       lost        - Number of lost records
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t fsm_trace_get_lost(void)
+{
+#if ( FSM_CFG_TRACE_EN )
+    return g_fsm_trace_lost;
+#else
+    return 0U;
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
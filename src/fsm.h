@@ -9,8 +9,8 @@
 *@email     ziga.miklosic@gmail.com
 *@author    Matej Otic
 *@email     otic.matej@dancing-bits.com
-*@date      26.09.2024
-*@version   V2.0.0
+*@date      28.08.2026
+*@version   V2.1.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -39,9 +39,25 @@
  *     Module version
  */
 #define FSM_VER_MAJOR       ( 2 )
-#define FSM_VER_MINOR       ( 0 )
+#define FSM_VER_MINOR       ( 1 )
 #define FSM_VER_DEVELOP     ( 0 )
 
+/**
+ *     Minimal footprint profile
+ *
+ *     When enabled state and machine name fields are compiled out of
+ *     configuration structures - per-state configuration packs tighter and
+ *     string data stays out of flash. Debug prints need names, therefore
+ *     minimal profile is only valid with debug mode disabled.
+ */
+#ifndef FSM_CFG_MINIMAL_EN
+    #define FSM_CFG_MINIMAL_EN  ( 0 )
+#endif
+
+#if ( FSM_CFG_MINIMAL_EN && FSM_CFG_DEBUG_EN )
+    #error "FSM_CFG_MINIMAL_EN strips state/machine names - disable FSM_CFG_DEBUG_EN!"
+#endif
+
 /**
  *     FSM status
  */
@@ -69,6 +85,68 @@ typedef union fsm_data
     } u8x4;         /**<Four 8-bit unsigned integers */
 } fsm_data_t;
 
+/**
+ *     Transition trace record
+ *
+ *     Compact binary record of single state transition. State names from
+ *     configuration table can be used to decode records on host side.
+ */
+typedef struct
+{
+    uint8_t     inst_id;    /**<Instance ID - assigned in order of init */
+    uint8_t     from;       /**<Exited state - FSM_STATE_NONE on initial transition */
+    uint8_t     to;         /**<Entered state */
+    uint8_t     res;        /**<Reserved for alignment */
+    uint32_t    tick;       /**<System tick of transition in ms */
+} fsm_trace_rec_t;
+
+/**
+ *     Invalid state marker
+ */
+#define FSM_STATE_NONE          ((uint8_t) 0xFFU )
+
+/**
+ *     Transition history record
+ *
+ *     Compact 4-byte record kept in per-instance history ring for postmortem
+ *     analysis - no I/O involved.
+ */
+typedef struct
+{
+    uint8_t     from;   /**<Exited state - FSM_STATE_NONE on initial transition */
+    uint8_t     to;     /**<Entered state */
+    uint16_t    tick;   /**<Lower 16 bits of system tick of transition in ms */
+} fsm_hist_rec_t;
+
+/**
+ *     Per-state execution time statistics
+ *
+ *     Accumulated over entry, activity and exit handler executions of given
+ *     state. Time unit is defined by "FSM_GET_TIMESTAMP" configuration macro
+ *     (e.g. DWT cycle counter on Cortex-M).
+ */
+typedef struct
+{
+    uint32_t    min;    /**<Shortest handler execution time */
+    uint32_t    max;    /**<Longest handler execution time */
+    uint32_t    total;  /**<Accumulated handler execution time */
+    uint32_t    cnt;    /**<Number of handler executions */
+} fsm_stats_t;
+
+/**
+ *     Per-instance memory footprint report
+ *
+ *     Helper for budgeting which machines earn RAM residency of their state
+ *     table ("fsm_cache_cfg"). All sizes in bytes.
+ */
+typedef struct
+{
+    uint32_t    inst_size;  /**<Instance size - always RAM resident */
+    uint32_t    cfg_size;   /**<Active state table size */
+    uint8_t     num_of;     /**<Number of states */
+    bool        cfg_cached; /**<State table served from RAM (shadow or resolved copy) */
+} fsm_mem_rpt_t;
+
 /**
  *     FSM instance type
  */
@@ -81,6 +159,107 @@ typedef struct fsm_s * p_fsm_t;
  */
 typedef void (*pf_state_t)(const p_fsm_t fsm_inst);
 
+/**
+ *     Pointer to state overrun callback
+ *
+ * @param[in]   fsm_inst    - FSM instance
+ * @param[in]   state       - Overrun state
+ * @param[in]   duration    - Time spent in state in ms
+ */
+typedef void (*pf_overrun_t)(const p_fsm_t fsm_inst, const uint8_t state, const uint32_t duration);
+
+/**
+ *     Pointer to transition observer callback
+ *
+ *     Invoked on every transition with raw integers only - no string
+ *     formatting on the hot path. Formatting/batching is up to observer
+ *     implementation, off the critical path.
+ *
+ * @param[in]   inst_id     - Instance ID
+ * @param[in]   from        - Exited state - FSM_STATE_NONE on initial transition
+ * @param[in]   to          - Entered state
+ * @param[in]   tick        - System tick of transition in ms
+ */
+typedef void (*pf_observer_t)(const uint8_t inst_id, const uint8_t from, const uint8_t to, const uint32_t tick);
+
+/**
+ *     State snapshot blob size in bytes
+ *
+ *     Fixed-layout, versioned binary blob produced by "fsm_save" - suitable
+ *     for retained RAM or EEPROM storage.
+ */
+#define FSM_SNAPSHOT_SIZE       ( 20 )
+
+/**
+ *     No wake needed marker
+ *
+ *     Returned by next wake API when machine has no time driven work pending
+ *     (e.g. idle event driven machine without timeout/period).
+ */
+#define FSM_WAKE_NONE           ((uint32_t) 0xFFFFFFFFUL )
+
+/**
+ *     Ignored event marker
+ *
+ *     Place into event lookup table for events that shall not trigger
+ *     transition in given state.
+ */
+#define FSM_EVENT_IGNORE        ((uint8_t) 0xFFU )
+
+/**
+ *     Transition guard condition
+ *
+ *     Masked compare against per-instance input word set via
+ *     "fsm_set_inputs". Guard matches when masked input bits equal "value" -
+ *     single AND+CMP on register-resident word instead of scattered boolean
+ *     loads in user handlers.
+ */
+typedef struct
+{
+    uint32_t    mask;       /**<Input bits relevant for guard */
+    uint32_t    value;      /**<Required value of masked input bits */
+    uint8_t     next_state; /**<State entered when guard matches */
+} fsm_guard_t;
+
+/**
+ *     Resumable activity handler macros (protothread technique)
+ *
+ *     Lets activity handler yield mid-sequence and resume at same point on
+ *     next handler call - multi-step sequences (EEPROM writes, comms
+ *     handshakes) no longer block the superloop nor need hand-split
+ *     sub-states. Continuation is single 16-bit slot in instance, cleared on
+ *     every state change - no stack switching involved.
+ *
+ *     Usage inside activity handler:
+ *
+ *         FSM_PT_BEGIN( fsm_inst );
+ *         start_write();
+ *         FSM_AWAIT( fsm_inst, write_done());
+ *         FSM_YIELD( fsm_inst );
+ *         finish();
+ *         FSM_PT_END( fsm_inst );
+ *
+ * @note    Based on switch over "__LINE__" - local variables do not survive
+ *          yield points, keep sequence state in shared data!
+ */
+#define FSM_PT_BEGIN(fsm_inst)      switch ( fsm_pt_get( fsm_inst )) { case 0:
+
+/**<Intended fallthrough into resume label - keeps -Wimplicit-fallthrough quiet */
+#if defined(__GNUC__) && ( __GNUC__ >= 7 )
+    #define FSM_PT_FALLTHROUGH      __attribute__((fallthrough))
+#else
+    #define FSM_PT_FALLTHROUGH      ((void) 0 )
+#endif
+
+/**<Yield handler - resume right after yield point on next call */
+#define FSM_YIELD(fsm_inst)         do { fsm_pt_set( (fsm_inst), (uint16_t) __LINE__ ); return; case __LINE__: ; } while (0)
+
+/**<Yield handler until condition holds - condition re-tested every call */
+#define FSM_AWAIT(fsm_inst, cond)   do { fsm_pt_set( (fsm_inst), (uint16_t) __LINE__ ); FSM_PT_FALLTHROUGH; case __LINE__: if ( !(cond)) { return; } } while (0)
+
+/**<Close resumable section - sequence restarts on next call */
+#define FSM_PT_END(fsm_inst)        } fsm_pt_set( (fsm_inst), 0U )
+
 /**
  *     State functions
  */
@@ -89,7 +268,61 @@ typedef struct
     pf_state_t on_entry;    /**<State entry function */
     pf_state_t on_activity; /**<State activity function */
     pf_state_t on_exit;     /**<State exit function */
+
+#if ( !FSM_CFG_MINIMAL_EN )
     const char* name;       /**<Name of state - for debug purposes */
+#endif
+
+    /**<Event to next state lookup table - optional
+     *
+     *  Dense table indexed by event ID with "num_of_events" entries, each
+     *  entry holding next state or "FSM_EVENT_IGNORE". Leave NULL when state
+     *  does not react to events.
+     */
+    const uint8_t * p_events;
+
+    /**<Guard condition table - optional
+     *
+     *  Candidate transitions out of state evaluated against instance input
+     *  word on every handler pass and on "fsm_set_inputs". First matching
+     *  guard wins. Leave NULL when state does not use guards.
+     */
+    const fsm_guard_t * p_guards;
+    uint8_t             num_of_guards;  /**<Number of guards in table */
+
+    /**<State timeout in ms - optional
+     *
+     *  When above 0 transition to "timeout_state" is requested once time
+     *  spent in state reaches "timeout_ms". Evaluated internally where state
+     *  duration is already being accumulated - no polling in activity
+     *  handler is needed.
+     */
+    uint32_t    timeout_ms;
+    uint8_t     timeout_state;  /**<State entered on timeout */
+
+    /**<Activity execution period in ms - optional
+     *
+     *  When above 0 activity handler is executed on first entry pass and
+     *  then only once every "period_ms", instead of on every handler call.
+     *  Entry/exit handlers and timeout evaluation are not affected.
+     */
+    uint32_t    period_ms;
+
+    /**<Maximum allowed time in state in ms - optional
+     *
+     *  When above 0 exceeding it increments instance overrun counter and
+     *  invokes registered overrun callback - once per state visit. Intended
+     *  as cheap in-path watchdog for states with bounded completion time.
+     */
+    uint32_t    max_duration_ms;
+
+    /**<Parent state - used only in hierarchical mode (FSM_CFG_HSM_EN)
+     *
+     *  Set to "FSM_STATE_NONE" for top level states! Parent states scope
+     *  entry/exit actions: transition exits up to and enters down from least
+     *  common ancestor of both states. Activity runs for active state only.
+     */
+    uint8_t     parent;
 } fsm_state_cfg_t;
 
 /**
@@ -97,25 +330,67 @@ typedef struct
  */
 typedef struct
 {
-    const fsm_state_cfg_t * p_states;   /**<Pointer to states of FSM */
-    const char *            name;       /**<Name of FSM machine */
-    uint8_t                 num_of;     /**<Number of all states */
+    const fsm_state_cfg_t * p_states;       /**<Pointer to states of FSM */
+
+#if ( !FSM_CFG_MINIMAL_EN )
+    const char *            name;           /**<Name of FSM machine */
+#endif
+    uint8_t                 num_of;         /**<Number of all states */
+    uint8_t                 num_of_events;  /**<Number of all events - 0 when event API is not used */
+    bool                    event_driven;   /**<Skip activity pass when no event/transition is pending */
 } fsm_cfg_t;
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
 fsm_status_t fsm_init               (p_fsm_t * p_fsm_inst, const fsm_cfg_t * const p_cfg);
+fsm_status_t fsm_init_static        (p_fsm_t * p_fsm_inst, const fsm_cfg_t * const p_cfg, void * const p_mem);
+fsm_status_t fsm_deinit             (p_fsm_t * p_fsm_inst);
+uint32_t     fsm_get_instance_size  (void);
+uint32_t     fsm_get_cfg_size       (const p_fsm_t fsm_inst);
+fsm_status_t fsm_cache_cfg          (const p_fsm_t fsm_inst, void * const p_mem, const uint32_t size);
+fsm_status_t fsm_get_mem_rpt        (const p_fsm_t fsm_inst, fsm_mem_rpt_t * const p_rpt);
 fsm_status_t fsm_is_init            (const p_fsm_t fsm_inst, bool * const p_is_init);
 fsm_status_t fsm_reset              (const p_fsm_t fsm_inst);
+fsm_status_t fsm_save               (const p_fsm_t fsm_inst, uint8_t * const p_buf, const uint32_t size);
+fsm_status_t fsm_restore            (const p_fsm_t fsm_inst, const uint8_t * const p_buf, const uint32_t size);
 fsm_status_t fsm_hndl               (const p_fsm_t fsm_inst);
+fsm_status_t fsm_hndl_tick          (const p_fsm_t fsm_inst, const uint32_t tick);
+fsm_status_t fsm_advance            (const p_fsm_t fsm_inst, const uint32_t elapsed_ms);
+fsm_status_t fsm_register           (const p_fsm_t fsm_inst);
+fsm_status_t fsm_register_worker    (const p_fsm_t fsm_inst, const uint8_t worker);
+fsm_status_t fsm_hndl_all           (void);
+fsm_status_t fsm_hndl_all_tick      (const uint32_t tick);
+fsm_status_t fsm_hndl_worker        (const uint8_t worker);
+fsm_status_t fsm_hndl_worker_tick   (const uint8_t worker, const uint32_t tick);
 fsm_status_t fsm_goto_state         (const p_fsm_t fsm_inst, const uint8_t state);
+fsm_status_t fsm_goto_state_with_arg(const p_fsm_t fsm_inst, const uint8_t state, const fsm_data_t arg);
+fsm_status_t fsm_post_event         (const p_fsm_t fsm_inst, const uint8_t event);
+fsm_status_t fsm_request_state      (const p_fsm_t fsm_inst, const uint8_t state);
+fsm_status_t fsm_subscribe          (const p_fsm_t publisher, const p_fsm_t subscriber, const uint8_t event_base);
+fsm_status_t fsm_set_inputs         (const p_fsm_t fsm_inst, const uint32_t inputs);
+uint32_t     fsm_get_inputs         (const p_fsm_t fsm_inst);
 uint8_t      fsm_get_state          (const p_fsm_t fsm_inst);
+uint8_t      fsm_get_hndl_state     (const p_fsm_t fsm_inst);
 uint32_t     fsm_get_duration       (const p_fsm_t fsm_inst);
+uint32_t     fsm_get_next_wake      (const p_fsm_t fsm_inst);
+uint32_t     fsm_get_next_wake_all  (void);
 void         fsm_reset_duration     (const p_fsm_t fsm_inst);
 fsm_data_t   fsm_get_data           (const p_fsm_t fsm_inst);
+void *       fsm_get_data_ptr       (const p_fsm_t fsm_inst);
 void         fsm_set_data           (const p_fsm_t fsm_inst, const fsm_data_t data);
 bool         fsm_get_first_entry    (const p_fsm_t fsm_inst);
+uint16_t     fsm_pt_get             (const p_fsm_t fsm_inst);
+void         fsm_pt_set             (const p_fsm_t fsm_inst, const uint16_t lc);
+void         fsm_set_overrun_cb     (const p_fsm_t fsm_inst, const pf_overrun_t callback);
+void         fsm_set_observer       (const p_fsm_t fsm_inst, const pf_observer_t observer);
+uint8_t      fsm_get_id             (const p_fsm_t fsm_inst);
+uint32_t     fsm_get_overrun_cnt    (const p_fsm_t fsm_inst);
+fsm_status_t fsm_get_stats          (const p_fsm_t fsm_inst, const uint8_t state, fsm_stats_t * const p_stats);
+fsm_status_t fsm_get_history        (const p_fsm_t fsm_inst, const uint8_t idx, fsm_hist_rec_t * const p_rec);
+uint8_t      fsm_get_history_cnt    (const p_fsm_t fsm_inst);
+bool         fsm_trace_get          (fsm_trace_rec_t * const p_rec);
+uint32_t     fsm_trace_get_lost     (void);
 
 #endif // __FSM_H_
 
@@ -0,0 +1,134 @@
+// Copyright (c) 2026 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     fsm_switch.h
+* @brief    Finite State Machine (FSM) Switch Dispatch Generator
+*@author    Ziga Miklosic
+*@email     ziga.miklosic@gmail.com
+*@author    Matej Otic
+*@email     otic.matej@dancing-bits.com
+*@date      28.08.2026
+*@version   V2.1.0
+*
+*@note      Compile-time specialization path for highest-rate machines where
+*           per-state function pointers defeat inlining: an X-macro state
+*           list generates "switch(state)" trampolines with direct - and
+*           under LTO inlinable - handler calls. Every state slot in the
+*           configuration table points to the same three trampolines, so the
+*           single remaining indirect call always hits one target and
+*           predicts perfectly. Runtime API stays identical - only the
+*           configuration declaration changes.
+*
+*           Usage:
+*
+*               // State list: X( state, on_entry, on_activity, on_exit )
+*               // Use "fsm_switch_nop" for unused handlers!
+*               #define APP_FSM_STATE_LIST(X)                                \
+*                   X( eAPP_FSM_POR,  fsm_switch_nop, por_hndl,  fsm_switch_nop ) \
+*                   X( eAPP_FSM_RUN,  run_entry,      run_hndl,  run_exit       )
+*
+*               // Generate trampolines: app_switch_entry/_activity/_exit
+*               FSM_SWITCH_DISPATCH_DEF( app, APP_FSM_STATE_LIST )
+*
+*               // Configuration rows reference generated trampolines
+*               static const fsm_cfg_t g_app_fsm_cfg =
+*               {
+*                   .p_states = (fsm_state_cfg_t[])
+*                   {
+*                       [eAPP_FSM_POR] = { FSM_SWITCH_HANDLERS( app ), .name="POR" },
+*                       [eAPP_FSM_RUN] = { FSM_SWITCH_HANDLERS( app ), .name="RUN" },
+*                   },
+*                   ...
+*               };
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup FSM_SWITCH
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __FSM_SWITCH_H_
+#define __FSM_SWITCH_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "fsm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     No-op handler placeholder for state list entries
+ *
+ *     Direct call to it folds to nothing after inlining - unlike NULL checks
+ *     on function pointer path.
+ */
+static inline void fsm_switch_nop(const p_fsm_t fsm_inst)
+{
+    (void) fsm_inst;
+}
+
+/**
+ *     Per-handler case emitters - applied to X-macro state list
+ */
+#define FSM_SWITCH_CASE_ENTRY(state, on_entry, on_activity, on_exit)    case (state): on_entry( fsm_inst ); break;
+#define FSM_SWITCH_CASE_ACTIVITY(state, on_entry, on_activity, on_exit) case (state): on_activity( fsm_inst ); break;
+#define FSM_SWITCH_CASE_EXIT(state, on_entry, on_activity, on_exit)     case (state): on_exit( fsm_inst ); break;
+
+/**
+ *     Generate switch dispatch trampolines out of X-macro state list
+ *
+ *     Emits three static functions named "prefix"_switch_entry,
+ *     "prefix"_switch_activity and "prefix"_switch_exit, each a
+ *     "switch(state)" over the list with direct handler calls.
+ */
+#define FSM_SWITCH_DISPATCH_DEF(prefix, state_list)                             \
+                                                                                \
+    static void prefix##_switch_entry(const p_fsm_t fsm_inst)                   \
+    {                                                                           \
+        switch ( fsm_get_hndl_state( fsm_inst ))                                \
+        {                                                                       \
+            state_list( FSM_SWITCH_CASE_ENTRY )                                 \
+            default: break;                                                     \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    static void prefix##_switch_activity(const p_fsm_t fsm_inst)                \
+    {                                                                           \
+        switch ( fsm_get_hndl_state( fsm_inst ))                                \
+        {                                                                       \
+            state_list( FSM_SWITCH_CASE_ACTIVITY )                              \
+            default: break;                                                     \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    static void prefix##_switch_exit(const p_fsm_t fsm_inst)                    \
+    {                                                                           \
+        switch ( fsm_get_hndl_state( fsm_inst ))                                \
+        {                                                                       \
+            state_list( FSM_SWITCH_CASE_EXIT )                                  \
+            default: break;                                                     \
+        }                                                                       \
+    }
+
+/**
+ *     Handler slots of single configuration table row - all states share the
+ *     same three trampolines
+ */
+#define FSM_SWITCH_HANDLERS(prefix)                                             \
+    .on_entry = prefix##_switch_entry,                                          \
+    .on_activity = prefix##_switch_activity,                                    \
+    .on_exit = prefix##_switch_exit
+
+#endif // __FSM_SWITCH_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////